@@ -1,12 +1,70 @@
 #include <benchmark/benchmark.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#endif
 #include "dsa/Array.hpp"
 #include "dsa/LinkedList.hpp"
 #include "dsa/Stack.hpp"
 #include "dsa/Queue.hpp"
 #include "dsa/Tree.hpp"
+#include "dsa/BPlusTree.hpp"
+#include "dsa/CompactTree.hpp"
+#include "dsa/FrozenSearchTree.hpp"
+#include "dsa/TreeMap.hpp"
+#include "dsa/PersistentTree.hpp"
+#include "dsa/TreeSetOps.hpp"
 #include "dsa/Graph.hpp"
 #include "dsa/HashMap.hpp"
+#include "dsa/ConcurrentHashMap.hpp"
+#include "dsa/FrozenHashMap.hpp"
+#include "dsa/SPSCQueue.hpp"
+#include "dsa/MPMCQueue.hpp"
+#include "dsa/BlockingQueue.hpp"
+#include "dsa/PriorityQueue.hpp"
+
+// Pins the calling thread to a core (modulo the core count); no-op elsewhere.
+static void pinThreadToCore(unsigned core) {
+#ifdef __linux__
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(core % cores, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)core;
+#endif
+}
+
+// Lets the calling thread run on any core again.
+static void unpinThread() {
+#ifdef __linux__
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (unsigned c = 0; c < cores; ++c)
+        CPU_SET(c, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
 
 // Array Benchmarks
 static void BM_ArrayPushBack(benchmark::State& state) {
@@ -95,6 +153,36 @@ static void BM_StackPop(benchmark::State& state) {
 }
 BENCHMARK(BM_StackPop)->Range(1<<10, 1<<18)->Complexity();
 
+// Batched variants: range(0) elements moved in batches of range(1).
+static void BM_StackPushBatch(benchmark::State& state) {
+    std::vector<int> batch(static_cast<std::size_t>(state.range(1)), 1);
+    for (auto _ : state) {
+        dsa::Stack<int> stack;
+        for (int64_t i = 0; i < state.range(0); i += state.range(1))
+            stack.push_range(batch.begin(), batch.end());
+        benchmark::DoNotOptimize(stack);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StackPushBatch)->Args({1<<16, 64})->Args({1<<16, 1024});
+
+static void BM_StackPopBatch(benchmark::State& state) {
+    std::vector<int> batch(static_cast<std::size_t>(state.range(1)), 1);
+    std::vector<int> out(batch.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        dsa::Stack<int> stack;
+        for (int64_t i = 0; i < state.range(0); i += state.range(1))
+            stack.push_range(batch.begin(), batch.end());
+        state.ResumeTiming();
+
+        while (stack.pop_n(out.begin(), out.size()) != 0)
+            benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_StackPopBatch)->Args({1<<16, 64})->Args({1<<16, 1024});
+
 // Queue Benchmarks
 static void BM_QueueEnqueue(benchmark::State& state) {
     dsa::Queue<int> queue;
@@ -124,6 +212,271 @@ static void BM_QueueDequeue(benchmark::State& state) {
 }
 BENCHMARK(BM_QueueDequeue)->Range(1<<10, 1<<18)->Complexity();
 
+// Batched variants: range(0) elements moved in batches of range(1).
+static void BM_QueueEnqueueBatch(benchmark::State& state) {
+    std::vector<int> batch(static_cast<std::size_t>(state.range(1)), 1);
+    for (auto _ : state) {
+        dsa::Queue<int> queue;
+        for (int64_t i = 0; i < state.range(0); i += state.range(1))
+            queue.enqueue_range(batch.begin(), batch.end());
+        benchmark::DoNotOptimize(queue);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QueueEnqueueBatch)->Args({1<<16, 64})->Args({1<<16, 1024});
+
+static void BM_QueueDequeueBatch(benchmark::State& state) {
+    std::vector<int> batch(static_cast<std::size_t>(state.range(1)), 1);
+    std::vector<int> out(batch.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        dsa::Queue<int> queue;
+        for (int64_t i = 0; i < state.range(0); i += state.range(1))
+            queue.enqueue_range(batch.begin(), batch.end());
+        state.ResumeTiming();
+
+        while (queue.dequeue_n(out.begin(), out.size()) != 0)
+            benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QueueDequeueBatch)->Args({1<<16, 64})->Args({1<<16, 1024});
+
+// SPSCQueue Benchmarks
+// Producer (benchmark thread, core 0) streams range(0) items per iteration to a
+// consumer pinned to core 1; range(1) is the batch size for push_n/pop_n.
+static void BM_SPSCQueueThroughput(benchmark::State& state) {
+    const std::size_t items = static_cast<std::size_t>(state.range(0));
+    const std::size_t batch = static_cast<std::size_t>(state.range(1));
+    dsa::SPSCQueue<int> queue(1024);
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> consumed{0};
+    std::thread consumer([&] {
+        pinThreadToCore(1);
+        std::vector<int> out(batch);
+        while (!done.load(std::memory_order_relaxed)) {
+            std::size_t n = queue.pop_n(out.data(), batch);
+            if (n)
+                consumed.fetch_add(n, std::memory_order_release);
+            else
+                std::this_thread::yield();
+        }
+    });
+    pinThreadToCore(0);
+    std::vector<int> in(batch, 1);
+    std::size_t target = 0;
+    for (auto _ : state) {
+        target += items;
+        for (std::size_t sent = 0; sent < items;) {
+            std::size_t n = queue.push_n(in.data(), std::min(batch, items - sent));
+            if (n == 0)
+                std::this_thread::yield();
+            sent += n;
+        }
+        while (consumed.load(std::memory_order_acquire) < target)
+            std::this_thread::yield();
+    }
+    done = true;
+    consumer.join();
+    unpinThread();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_SPSCQueueThroughput)->Args({1<<16, 1})->Args({1<<16, 64})->UseRealTime();
+
+// Baseline for BM_SPSCQueueThroughput: the same hand-off through a mutex-guarded dsa::Queue.
+static void BM_MutexQueueThroughput(benchmark::State& state) {
+    const std::size_t items = static_cast<std::size_t>(state.range(0));
+    dsa::Queue<int> queue;
+    std::mutex mutex;
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> consumed{0};
+    std::thread consumer([&] {
+        pinThreadToCore(1);
+        while (!done.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!queue.empty()) {
+                queue.dequeue();
+                consumed.fetch_add(1, std::memory_order_release);
+            }
+        }
+    });
+    pinThreadToCore(0);
+    std::size_t target = 0;
+    for (auto _ : state) {
+        target += items;
+        for (std::size_t i = 0; i < items; ++i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.enqueue(1);
+        }
+        while (consumed.load(std::memory_order_acquire) < target)
+            std::this_thread::yield();
+    }
+    done = true;
+    consumer.join();
+    unpinThread();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_MutexQueueThroughput)->Arg(1<<16)->UseRealTime();
+
+// Round-trip latency: a token bounces between two pinned threads over a pair of rings.
+static void BM_SPSCQueuePingPong(benchmark::State& state) {
+    dsa::SPSCQueue<int> ping(64);
+    dsa::SPSCQueue<int> pong(64);
+    std::atomic<bool> done{false};
+    std::thread echo([&] {
+        pinThreadToCore(1);
+        int token;
+        while (!done.load(std::memory_order_relaxed)) {
+            if (ping.try_pop(token))
+                while (!pong.try_push(token)) {}
+            else
+                std::this_thread::yield();
+        }
+    });
+    pinThreadToCore(0);
+    int token = 0;
+    for (auto _ : state) {
+        while (!ping.try_push(token)) {}
+        while (!pong.try_pop(token))
+            std::this_thread::yield();
+    }
+    done = true;
+    echo.join();
+    unpinThread();
+}
+BENCHMARK(BM_SPSCQueuePingPong)->UseRealTime();
+
+// MPMCQueue Benchmarks
+// Every thread enqueues one item and then dequeues one (possibly another
+// thread's), so the shared queue sees a balanced mix of both operations.
+static void BM_MPMCQueueEnqueueDequeue(benchmark::State& state) {
+    static dsa::MPMCQueue<int> queue(1024);
+    int value = 0;
+    for (auto _ : state) {
+        while (!queue.try_enqueue(value))
+            std::this_thread::yield();
+        while (!queue.try_dequeue(value))
+            std::this_thread::yield();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPMCQueueEnqueueDequeue)->ThreadRange(1, 16)->UseRealTime();
+
+// Baseline for BM_MPMCQueueEnqueueDequeue: a dsa::Queue behind one mutex.
+static void BM_MutexQueueEnqueueDequeue(benchmark::State& state) {
+    static dsa::Queue<int> queue;
+    static std::mutex mutex;
+    for (auto _ : state) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.enqueue(1);
+        }
+        for (bool done = false; !done;) {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!queue.empty()) {
+                queue.dequeue();
+                done = true;
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexQueueEnqueueDequeue)->ThreadRange(1, 16)->UseRealTime();
+
+// BlockingQueue Benchmarks
+// The benchmark thread pushes bursts of range(0) items to range(1) parked
+// consumers that take one item with pop_wait and then drain in batches.
+static void BM_BlockingQueueBurst(benchmark::State& state) {
+    const std::size_t burst = static_cast<std::size_t>(state.range(0));
+    dsa::BlockingQueue<int> queue;
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::thread> consumers;
+    for (int64_t c = 0; c < state.range(1); ++c)
+        consumers.emplace_back([&] {
+            std::vector<int> batch;
+            int value;
+            while (queue.pop_wait(value, std::chrono::seconds(1))) {
+                batch.clear();
+                std::size_t n = 1 + queue.drain_to(batch, 64);
+                consumed.fetch_add(n, std::memory_order_release);
+            }
+        });
+    std::size_t target = 0;
+    for (auto _ : state) {
+        target += burst;
+        for (std::size_t i = 0; i < burst; ++i)
+            queue.push(static_cast<int>(i));
+        while (consumed.load(std::memory_order_acquire) < target)
+            std::this_thread::yield();
+    }
+    queue.close();
+    for (auto& t : consumers)
+        t.join();
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_BlockingQueueBurst)->Args({256, 1})->Args({256, 4})->UseRealTime();
+
+// PriorityQueue Benchmarks: binary vs. 4-ary layout
+template<std::size_t Arity>
+static void BM_PriorityQueuePushPop(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+    for (auto& v : values)
+        v = static_cast<int>(rng());
+    for (auto _ : state) {
+        dsa::PriorityQueue<int, std::greater<int>, Arity> pq;
+        for (int v : values)
+            pq.push(v);
+        while (!pq.empty()) {
+            benchmark::DoNotOptimize(pq.top());
+            pq.pop();
+        }
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PriorityQueuePushPop, 2)->Range(1<<10, 1<<18)->Complexity();
+BENCHMARK_TEMPLATE(BM_PriorityQueuePushPop, 4)->Range(1<<10, 1<<18)->Complexity();
+
+template<std::size_t Arity>
+static void BM_PriorityQueueHeapify(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+    for (auto& v : values)
+        v = static_cast<int>(rng());
+    for (auto _ : state) {
+        dsa::PriorityQueue<int, std::greater<int>, Arity> pq(values.begin(), values.end());
+        benchmark::DoNotOptimize(pq.top());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_PriorityQueueHeapify, 2)->Range(1<<10, 1<<18)->Complexity();
+BENCHMARK_TEMPLATE(BM_PriorityQueueHeapify, 4)->Range(1<<10, 1<<18)->Complexity();
+
+// Dijkstra-style workload: pops interleaved with decrease_key on live handles.
+template<std::size_t Arity>
+static void BM_IndexedPriorityQueueDecreaseKey(benchmark::State& state) {
+    const std::size_t n = static_cast<std::size_t>(state.range(0));
+    std::mt19937 rng(42);
+    for (auto _ : state) {
+        dsa::IndexedPriorityQueue<unsigned, std::greater<unsigned>, Arity> pq;
+        std::vector<std::size_t> handles;
+        for (std::size_t i = 0; i < n; ++i)
+            handles.push_back(pq.push(1000000u + rng() % 1000000u));
+        while (!pq.empty()) {
+            unsigned top = pq.top();
+            pq.pop();
+            for (int k = 0; k < 4; ++k) {
+                std::size_t h = handles[rng() % n];
+                if (pq.contains(h) && pq.get(h) > top + 1)
+                    pq.decrease_key(h, top + 1 + rng() % (pq.get(h) - top - 1));
+            }
+        }
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_IndexedPriorityQueueDecreaseKey, 2)->Range(1<<10, 1<<16)->Complexity();
+BENCHMARK_TEMPLATE(BM_IndexedPriorityQueueDecreaseKey, 4)->Range(1<<10, 1<<16)->Complexity();
+
 // Tree Benchmarks
 static void BM_TreeInsert(benchmark::State& state) {
     dsa::Tree<int> tree;
@@ -152,6 +505,438 @@ static void BM_TreeRemove(benchmark::State& state) {
 }
 BENCHMARK(BM_TreeRemove)->Range(1<<10, 1<<18)->Complexity();
 
+// Key orders for the balancing benchmarks.
+enum TreeKeyOrder { SortedKeys, ReverseSortedKeys, RandomKeys };
+
+static std::vector<int> makeTreeKeys(int64_t n, int64_t order) {
+    std::vector<int> keys(static_cast<std::size_t>(n));
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        keys[i] = static_cast<int>(i);
+    if (order == ReverseSortedKeys)
+        std::reverse(keys.begin(), keys.end());
+    else if (order == RandomKeys)
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+    return keys;
+}
+
+static void BM_TreeIterate(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    dsa::RedBlackTree<int> tree;
+    for (int k : keys)
+        tree.insert(k);
+    for (auto _ : state) {
+        long long sum = 0;
+        for (auto it = tree.cbegin(); it != tree.cend(); ++it)
+            sum += *it;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TreeIterate)->Range(1<<10, 1<<18)->Complexity();
+
+// Answers rank, select and count_range queries on a red-black tree of range(0) keys.
+static void BM_TreeOrderStatistics(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    dsa::RedBlackTree<int> tree;
+    for (int k : keys)
+        tree.insert(k);
+    const std::size_t n = keys.size();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        int k = keys[i];
+        benchmark::DoNotOptimize(tree.rank(k));
+        benchmark::DoNotOptimize(tree.select(static_cast<std::size_t>(k)));
+        benchmark::DoNotOptimize(tree.count_range(k, k + 100));
+        i = i + 1 == n ? 0 : i + 1;
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TreeOrderStatistics)->Range(1<<10, 1<<18)->Complexity(benchmark::oLogN);
+
+// Sums the 64 keys following a lower_bound, via the range() view.
+static void BM_TreeRangeScan(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    dsa::RedBlackTree<int> tree;
+    for (int k : keys)
+        tree.insert(k);
+    const std::size_t n = keys.size();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int k : tree.range(keys[i], keys[i] + 64))
+            sum += k;
+        benchmark::DoNotOptimize(sum);
+        i = i + 1 == n ? 0 : i + 1;
+    }
+}
+BENCHMARK(BM_TreeRangeScan)->Range(1<<10, 1<<18);
+
+// Builds a red-black tree from range(0) sorted keys: bulk load vs repeated insert.
+static void BM_TreeFromSorted(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), SortedKeys);
+    for (auto _ : state) {
+        auto tree = dsa::RedBlackTree<int>::from_sorted(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(tree.size());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TreeFromSorted)->Range(1<<10, 1<<18)->Complexity(benchmark::oN);
+
+static void BM_TreeInsertSorted(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), SortedKeys);
+    for (auto _ : state) {
+        dsa::RedBlackTree<int> tree;
+        for (int k : keys)
+            tree.insert(k);
+        benchmark::DoNotOptimize(tree.size());
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_TreeInsertSorted)->Range(1<<10, 1<<18)->Complexity(benchmark::oNLogN);
+
+// Builds from range(0) shuffled keys, sorting with range(1) tasks.
+static void BM_TreeFromUnsorted(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    for (auto _ : state) {
+        auto tree = dsa::RedBlackTree<int>::from_unsorted(keys.begin(), keys.end(),
+                                                         static_cast<unsigned>(state.range(1)));
+        benchmark::DoNotOptimize(tree.size());
+    }
+}
+BENCHMARK(BM_TreeFromUnsorted)->ArgsProduct({{1<<14, 1<<18}, {1, 4}})->UseRealTime();
+
+// Looks up Zipf-distributed keys among range(0) keys inserted in random order,
+// with exponent range(1) / 10; at 13 about 90% of lookups hit the top 1% of keys.
+// Popularity is shuffled independently of insertion order.
+template<typename TreeType>
+static void BM_TreeZipfLookup(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    TreeType tree;
+    for (int k : keys)
+        tree.insert(k);
+    const double exponent = static_cast<double>(state.range(1)) / 10;
+    std::vector<double> weights;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        weights.push_back(1.0 / std::pow(static_cast<double>(i + 1), exponent));
+    std::discrete_distribution<std::size_t> popularity(weights.begin(), weights.end());
+    std::mt19937 rng(7);
+    std::vector<int> byPopularity = keys;
+    std::shuffle(byPopularity.begin(), byPopularity.end(), rng);
+    std::vector<int> probes(1 << 16);
+    for (int& p : probes)
+        p = byPopularity[popularity(rng)];
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.search(probes[i]));
+        i = (i + 1) & (probes.size() - 1);
+    }
+}
+BENCHMARK_TEMPLATE(BM_TreeZipfLookup, dsa::Tree<int>)->ArgsProduct({{1<<12, 1<<16, 1<<20}, {0, 13}});
+BENCHMARK_TEMPLATE(BM_TreeZipfLookup, dsa::RedBlackTree<int>)->ArgsProduct({{1<<12, 1<<16, 1<<20}, {0, 13}});
+BENCHMARK_TEMPLATE(BM_TreeZipfLookup, dsa::Treap<int>)->ArgsProduct({{1<<12, 1<<16, 1<<20}, {0, 13}});
+
+// Pointer-linked AVL nodes vs the index-linked node pool: insert + search range(0) random keys.
+template<typename TreeType>
+static void BM_TreeLayoutInsertSearch(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    for (auto _ : state) {
+        TreeType tree;
+        for (int k : keys)
+            tree.insert(k);
+        for (int k : keys)
+            benchmark::DoNotOptimize(tree.search(k));
+    }
+}
+BENCHMARK_TEMPLATE(BM_TreeLayoutInsertSearch, dsa::AVLTree<int>)->Range(1<<10, 1<<18);
+BENCHMARK_TEMPLATE(BM_TreeLayoutInsertSearch, dsa::CompactTree<int>)->Range(1<<10, 1<<18);
+
+// Copies a tree of range(0) keys; the node pool copies with one allocation.
+template<typename TreeType>
+static void BM_TreeLayoutCopy(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    TreeType tree;
+    for (int k : keys)
+        tree.insert(k);
+    for (auto _ : state) {
+        TreeType copy(tree);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK_TEMPLATE(BM_TreeLayoutCopy, dsa::AVLTree<int>)->Range(1<<10, 1<<18);
+BENCHMARK_TEMPLATE(BM_TreeLayoutCopy, dsa::CompactTree<int>)->Range(1<<10, 1<<18);
+
+// Unites two AVL trees of range(0) keys (one third shared) with range(1) tasks.
+static void makeUnionInputs(int64_t n, dsa::AVLTree<int>& a, dsa::AVLTree<int>& b) {
+    std::vector<int> evens = makeTreeKeys(n, SortedKeys), triples = evens;
+    for (int& k : evens)
+        k *= 2;
+    for (int& k : triples)
+        k *= 3;
+    a = dsa::AVLTree<int>::from_sorted(evens.begin(), evens.end());
+    b = dsa::AVLTree<int>::from_sorted(triples.begin(), triples.end());
+}
+
+static void BM_TreeSetUnion(benchmark::State& state) {
+    dsa::AVLTree<int> a, b;
+    makeUnionInputs(state.range(0), a, b);
+    const unsigned threads = static_cast<unsigned>(state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        dsa::AVLTree<int> left(a), right(b);
+        state.ResumeTiming();
+        dsa::AVLTree<int> both = dsa::set_union(std::move(left), std::move(right), threads);
+        benchmark::DoNotOptimize(both.size());
+        state.PauseTiming();
+        both = dsa::AVLTree<int>();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_TreeSetUnion)->ArgsProduct({{1<<16, 1<<20}, {1, 2, 4, 8}})->UseRealTime();
+
+// Baseline: inserts every element of the second tree into the first, one by one.
+static void BM_TreeInsertUnion(benchmark::State& state) {
+    dsa::AVLTree<int> a, b;
+    makeUnionInputs(state.range(0), a, b);
+    for (auto _ : state) {
+        state.PauseTiming();
+        dsa::AVLTree<int> both(a);
+        state.ResumeTiming();
+        for (int k : b)
+            both.insert(k);
+        benchmark::DoNotOptimize(both.size());
+        state.PauseTiming();
+        both = dsa::AVLTree<int>();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_TreeInsertUnion)->Arg(1<<16)->Arg(1<<20)->UseRealTime();
+
+// Read-only lookup of random present keys among range(0) even keys, four ways.
+static std::vector<int> makeLookupProbes(int64_t n) {
+    std::vector<int> probes = makeTreeKeys(n, RandomKeys);
+    for (int& p : probes)
+        p *= 2;
+    return probes;
+}
+
+static void BM_LookupFrozenSearchTree(benchmark::State& state) {
+    std::vector<int> sorted = makeTreeKeys(state.range(0), SortedKeys);
+    for (int& k : sorted)
+        k *= 2;
+    dsa::FrozenSearchTree<int> table(sorted.begin(), sorted.end());
+    std::vector<int> probes = makeLookupProbes(state.range(0));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.contains(probes[i]));
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+}
+BENCHMARK(BM_LookupFrozenSearchTree)->Range(1<<10, 1<<22);
+
+static void BM_LookupBinarySearchTree(benchmark::State& state) {
+    std::vector<int> sorted = makeTreeKeys(state.range(0), SortedKeys);
+    for (int& k : sorted)
+        k *= 2;
+    auto tree = dsa::RedBlackTree<int>::from_sorted(sorted.begin(), sorted.end());
+    std::vector<int> probes = makeLookupProbes(state.range(0));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tree.search(probes[i]));
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+}
+BENCHMARK(BM_LookupBinarySearchTree)->Range(1<<10, 1<<22);
+
+static void BM_LookupStdLowerBound(benchmark::State& state) {
+    std::vector<int> sorted = makeTreeKeys(state.range(0), SortedKeys);
+    for (int& k : sorted)
+        k *= 2;
+    std::vector<int> probes = makeLookupProbes(state.range(0));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto it = std::lower_bound(sorted.begin(), sorted.end(), probes[i]);
+        benchmark::DoNotOptimize(it != sorted.end() && *it == probes[i]);
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+}
+BENCHMARK(BM_LookupStdLowerBound)->Range(1<<10, 1<<22);
+
+static void BM_LookupStdSet(benchmark::State& state) {
+    std::vector<int> sorted = makeTreeKeys(state.range(0), SortedKeys);
+    for (int& k : sorted)
+        k *= 2;
+    std::set<int> set(sorted.begin(), sorted.end());
+    std::vector<int> probes = makeLookupProbes(state.range(0));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(set.find(probes[i]));
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+}
+BENCHMARK(BM_LookupStdSet)->Range(1<<10, 1<<22);
+
+// Upserts range(0) random keys twice (insert, then assign) with a single descent each.
+template<typename MapType>
+static void BM_MapInsertOrAssign(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    for (auto _ : state) {
+        MapType map;
+        for (int round = 0; round < 2; ++round)
+            for (int k : keys)
+                map.insert_or_assign(k, round);
+        benchmark::DoNotOptimize(map.size());
+    }
+}
+BENCHMARK_TEMPLATE(BM_MapInsertOrAssign, dsa::TreeMap<int, int>)->Range(1<<10, 1<<18);
+BENCHMARK_TEMPLATE(BM_MapInsertOrAssign, std::map<int, int>)->Range(1<<10, 1<<18);
+
+// Looks up string keys by const char*; transparent comparators skip the std::string temporary.
+template<typename MapType>
+static void BM_MapHeterogeneousFind(benchmark::State& state) {
+    std::vector<std::string> names;
+    for (int k : makeTreeKeys(state.range(0), RandomKeys))
+        names.push_back("customer-" + std::to_string(k) + "-with-a-long-key");
+    MapType map;
+    for (const std::string& name : names)
+        map.insert_or_assign(name, 1);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map.find(names[i].c_str()));
+        i = i + 1 == names.size() ? 0 : i + 1;
+    }
+}
+BENCHMARK_TEMPLATE(BM_MapHeterogeneousFind, dsa::TreeMap<std::string, int>)->Range(1<<10, 1<<16);
+BENCHMARK_TEMPLATE(BM_MapHeterogeneousFind, dsa::TreeMap<std::string, int, std::less<>>)->Range(1<<10, 1<<16);
+BENCHMARK_TEMPLATE(BM_MapHeterogeneousFind, std::map<std::string, int, std::less<>>)->Range(1<<10, 1<<16);
+
+// Lookups from every thread while thread 0 keeps updating: snapshots vs a mutex-guarded tree.
+static dsa::PersistentTree<int>* persistentShared = nullptr;
+
+static void BM_PersistentTreeReadWhileWriting(benchmark::State& state) {
+    const int n = 1 << 16;
+    if (state.thread_index() == 0) {
+        persistentShared = new dsa::PersistentTree<int>(128);
+        for (int k : makeTreeKeys(n, RandomKeys))
+            persistentShared->insert(k);
+    }
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+    for (auto _ : state) {
+        int key = static_cast<int>(rng() % n);
+        if (state.thread_index() == 0) {
+            persistentShared->remove(key);
+            persistentShared->insert(key);
+        } else {
+            auto snap = persistentShared->snapshot();
+            benchmark::DoNotOptimize(snap.contains(key));
+        }
+    }
+    if (state.thread_index() == 0) {
+        delete persistentShared;
+        persistentShared = nullptr;
+    }
+}
+BENCHMARK(BM_PersistentTreeReadWhileWriting)->ThreadRange(1, 16)->UseRealTime();
+
+static dsa::RedBlackTree<int>* lockedShared = nullptr;
+static std::mutex lockedSharedMutex;
+
+static void BM_LockedTreeReadWhileWriting(benchmark::State& state) {
+    const int n = 1 << 16;
+    if (state.thread_index() == 0) {
+        lockedShared = new dsa::RedBlackTree<int>();
+        for (int k : makeTreeKeys(n, RandomKeys))
+            lockedShared->insert(k);
+    }
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()));
+    for (auto _ : state) {
+        int key = static_cast<int>(rng() % n);
+        std::lock_guard<std::mutex> lock(lockedSharedMutex);
+        if (state.thread_index() == 0) {
+            lockedShared->remove(key);
+            lockedShared->insert(key);
+        } else {
+            benchmark::DoNotOptimize(lockedShared->search(key));
+        }
+    }
+    if (state.thread_index() == 0) {
+        delete lockedShared;
+        lockedShared = nullptr;
+    }
+}
+BENCHMARK(BM_LockedTreeReadWhileWriting)->ThreadRange(1, 16)->UseRealTime();
+
+// Inserts range(0) keys in the order given by range(1), then searches each once.
+template<typename Balance>
+static void BM_TreeBalancedInsertSearch(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), state.range(1));
+    for (auto _ : state) {
+        dsa::BinarySearchTree<int, Balance> tree;
+        for (int k : keys)
+            tree.insert(k);
+        for (int k : keys)
+            benchmark::DoNotOptimize(tree.search(k));
+    }
+}
+
+// Removes range(0) keys, in the order given by range(1), from a tree built in that order.
+template<typename Balance>
+static void BM_TreeBalancedRemove(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), state.range(1));
+    for (auto _ : state) {
+        state.PauseTiming();
+        dsa::BinarySearchTree<int, Balance> tree;
+        for (int k : keys)
+            tree.insert(k);
+        state.ResumeTiming();
+
+        for (int k : keys)
+            tree.remove(k);
+    }
+}
+
+// The unbalanced tree degenerates on ordered keys, so it gets smaller sizes.
+BENCHMARK_TEMPLATE(BM_TreeBalancedInsertSearch, dsa::NoBalance)
+    ->ArgsProduct({benchmark::CreateRange(1<<10, 1<<13, 2), {SortedKeys, ReverseSortedKeys, RandomKeys}});
+BENCHMARK_TEMPLATE(BM_TreeBalancedInsertSearch, dsa::AVLBalance)
+    ->ArgsProduct({benchmark::CreateRange(1<<10, 1<<18, 8), {SortedKeys, ReverseSortedKeys, RandomKeys}});
+BENCHMARK_TEMPLATE(BM_TreeBalancedInsertSearch, dsa::RedBlackBalance)
+    ->ArgsProduct({benchmark::CreateRange(1<<10, 1<<18, 8), {SortedKeys, ReverseSortedKeys, RandomKeys}});
+BENCHMARK_TEMPLATE(BM_TreeBalancedRemove, dsa::AVLBalance)
+    ->ArgsProduct({benchmark::CreateRange(1<<10, 1<<18, 8), {SortedKeys, ReverseSortedKeys, RandomKeys}});
+BENCHMARK_TEMPLATE(BM_TreeBalancedRemove, dsa::RedBlackBalance)
+    ->ArgsProduct({benchmark::CreateRange(1<<10, 1<<18, 8), {SortedKeys, ReverseSortedKeys, RandomKeys}});
+
+// B+tree node size sweep: range(0) random keys inserted then searched.
+template<std::size_t NodeBytes>
+static void BM_BPlusTreeInsertSearch(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    for (auto _ : state) {
+        dsa::BPlusTree<int, int, NodeBytes> tree;
+        for (int k : keys)
+            tree.insert(k, k);
+        for (int k : keys)
+            benchmark::DoNotOptimize(tree.find(k));
+    }
+}
+BENCHMARK_TEMPLATE(BM_BPlusTreeInsertSearch, 64)->Range(1<<10, 1<<18);
+BENCHMARK_TEMPLATE(BM_BPlusTreeInsertSearch, 256)->Range(1<<10, 1<<18);
+BENCHMARK_TEMPLATE(BM_BPlusTreeInsertSearch, 1024)->Range(1<<10, 1<<18);
+
+// Scans every entry through the linked leaves.
+static void BM_BPlusTreeScan(benchmark::State& state) {
+    std::vector<int> keys = makeTreeKeys(state.range(0), RandomKeys);
+    dsa::BPlusTree<int, int> tree;
+    for (int k : keys)
+        tree.insert(k, k);
+    for (auto _ : state) {
+        long long sum = 0;
+        tree.scan(0, static_cast<int>(state.range(0)), [&](int, int v) { sum += v; });
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetComplexityN(state.range(0));
+}
+BENCHMARK(BM_BPlusTreeScan)->Range(1<<10, 1<<18)->Complexity();
+
 // Graph Benchmarks
 static void BM_GraphAddVertex(benchmark::State& state) {
     dsa::Graph<int> graph;
@@ -210,4 +995,278 @@ static void BM_HashMapRemove(benchmark::State& state) {
 }
 BENCHMARK(BM_HashMapRemove)->Range(1<<10, 1<<18)->Complexity();
 
+// Chained HashMap vs Swiss and Robin Hood tables vs std::unordered_map at 10^3..10^8 random int keys.
+template<typename K, typename V, typename Layout>
+static void hashPut(dsa::HashMap<K, V, Layout>& map, const K& key, const V& value) { map.put(key, value); }
+template<typename K, typename V, typename Layout>
+static bool hashFind(const dsa::HashMap<K, V, Layout>& map, const K& key) { return map.find(key) != nullptr; }
+static void hashPut(std::unordered_map<int, int>& map, int key, int value) { map[key] = value; }
+static bool hashFind(const std::unordered_map<int, int>& map, int key) { return map.find(key) != map.end(); }
+
+static std::vector<int> makeHashKeys(int64_t n) {
+    std::mt19937 rng(12345);
+    std::vector<int> keys(static_cast<std::size_t>(n));
+    for (int& k : keys)
+        k = static_cast<int>(rng());
+    return keys;
+}
+
+template<typename Map>
+static void BM_HashInsert(benchmark::State& state) {
+    std::vector<int> keys = makeHashKeys(state.range(0));
+    for (auto _ : state) {
+        Map map;
+        for (int k : keys)
+            hashPut(map, k, k);
+        benchmark::DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_HashInsert, dsa::HashMap<int, int>)
+    ->RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashInsert, dsa::SwissHashMap<int, int>)
+    ->RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashInsert, dsa::RobinHoodHashMap<int, int>)
+    ->RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashInsert, std::unordered_map<int, int>)
+    ->RangeMultiplier(10)->Range(1000, 100000000)->Unit(benchmark::kMillisecond);
+
+// Looks up present keys in random order, then keys that are absent.
+template<typename Map>
+static void BM_HashLookup(benchmark::State& state) {
+    std::vector<int> keys = makeHashKeys(state.range(0));
+    Map map;
+    for (int k : keys)
+        hashPut(map, k, k);
+    std::vector<int> probes = keys;
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+    if (state.range(1) == 0) {
+        for (int& p : probes)
+            p = ~p;
+    }
+    const std::size_t n = probes.size();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashFind(map, probes[i]));
+        i = i + 1 == n ? 0 : i + 1;
+    }
+}
+BENCHMARK_TEMPLATE(BM_HashLookup, dsa::HashMap<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1000, 100000000, 10), {1, 0}});
+BENCHMARK_TEMPLATE(BM_HashLookup, dsa::SwissHashMap<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1000, 100000000, 10), {1, 0}});
+BENCHMARK_TEMPLATE(BM_HashLookup, dsa::RobinHoodHashMap<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1000, 100000000, 10), {1, 0}});
+BENCHMARK_TEMPLATE(BM_HashLookup, std::unordered_map<int, int>)
+    ->ArgsProduct({benchmark::CreateRange(1000, 100000000, 10), {1, 0}});
+
+// Inserts then finds 2^16 keys spaced by arg 0 in a chained map, for each
+// hash finalizer; without one, strided keys pile into few buckets.
+template<typename Mix>
+static void BM_HashChainMix(benchmark::State& state) {
+    const int stride = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        dsa::HashMap<int, int, dsa::BasicSeparateChaining<Mix>> map;
+        for (int i = 0; i < (1 << 16); ++i)
+            map.put(i * stride, i);
+        for (int i = 0; i < (1 << 16); ++i)
+            benchmark::DoNotOptimize(map.find(i * stride));
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 16));
+}
+BENCHMARK_TEMPLATE(BM_HashChainMix, dsa::NoMix)->Arg(1)->Arg(1024)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashChainMix, dsa::WyMix)->Arg(1)->Arg(1024)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_HashChainMix, dsa::Xxh3Mix)->Arg(1)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+// Looks up 32-character keys held as string_views: with arg 0 each lookup
+// first builds the std::string key, with arg 1 find() takes the view.
+template<typename Map>
+static void BM_HashStringViewLookup(benchmark::State& state) {
+    std::vector<std::string> keys;
+    for (int k : makeHashKeys(100000))
+        keys.push_back("user:" + std::to_string(k) + std::string(16, '#'));
+    Map map;
+    for (std::size_t i = 0; i < keys.size(); ++i)
+        map.put(keys[i], static_cast<int>(i));
+    std::vector<std::string_view> probes(keys.begin(), keys.end());
+    std::shuffle(probes.begin(), probes.end(), std::mt19937(7));
+    const bool transparent = state.range(0) != 0;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        if (transparent)
+            benchmark::DoNotOptimize(map.find(probes[i]));
+        else
+            benchmark::DoNotOptimize(map.find(std::string(probes[i])));
+        i = i + 1 == probes.size() ? 0 : i + 1;
+    }
+}
+BENCHMARK_TEMPLATE(BM_HashStringViewLookup, dsa::HashMap<std::string, int>)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_HashStringViewLookup, dsa::SwissHashMap<std::string, int>)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_HashStringViewLookup, dsa::RobinHoodHashMap<std::string, int>)->Arg(0)->Arg(1);
+
+// Bytes currently allocated from the heap, or 0 where that cannot be queried.
+static double heapInUse() {
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+    struct mallinfo2 info = mallinfo2();
+    return static_cast<double>(info.uordblks + info.hblkhd);
+#else
+    return 0;
+#endif
+}
+
+// Reports the median, tail and worst of per-operation latency samples (in ns).
+static void setLatencyCounters(benchmark::State& state, std::vector<double>& samples) {
+    if (samples.empty())
+        return;
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double q) { return samples[static_cast<std::size_t>(q * (samples.size() - 1))]; };
+    state.counters["p50_ns"] = at(0.5);
+    state.counters["p99_ns"] = at(0.99);
+    state.counters["p999_ns"] = at(0.999);
+    state.counters["max_ns"] = samples.back();
+}
+
+// Times single hits in a map loaded to 0.89 of 2^20 slots, near the Robin Hood
+// table's limit, and reports tail latency and heap bytes per entry.
+template<typename Map>
+static void BM_HashLookupLatency(benchmark::State& state) {
+    std::vector<int> keys = makeHashKeys(933000);
+    double before = heapInUse();
+    Map map;
+    for (int k : keys)
+        hashPut(map, k, k);
+    state.counters["bytes_per_entry"] = (heapInUse() - before) / keys.size();
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    std::vector<double> samples;
+    samples.reserve(1 << 20);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(hashFind(map, keys[i]));
+        auto stop = std::chrono::steady_clock::now();
+        if (samples.size() < samples.capacity())
+            samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+        i = i + 1 == keys.size() ? 0 : i + 1;
+    }
+    setLatencyCounters(state, samples);
+}
+BENCHMARK_TEMPLATE(BM_HashLookupLatency, dsa::HashMap<int, int>);
+BENCHMARK_TEMPLATE(BM_HashLookupLatency, dsa::SwissHashMap<int, int>);
+BENCHMARK_TEMPLATE(BM_HashLookupLatency, dsa::RobinHoodHashMap<int, int>);
+BENCHMARK_TEMPLATE(BM_HashLookupLatency, std::unordered_map<int, int>);
+
+// Times single inserts while filling maps with 2^21 keys, one map after
+// another, so the tail shows the inserts that trigger a rehash.
+template<typename Map>
+static void BM_HashInsertLatency(benchmark::State& state) {
+    std::vector<int> keys = makeHashKeys(1 << 21);
+    std::vector<double> samples;
+    samples.reserve(1 << 22);
+    auto map = std::make_unique<Map>();
+    std::size_t i = 0;
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        hashPut(*map, keys[i], 0);
+        auto stop = std::chrono::steady_clock::now();
+        if (samples.size() < samples.capacity())
+            samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+        if (++i == keys.size()) {
+            state.PauseTiming();
+            map = std::make_unique<Map>();
+            i = 0;
+            state.ResumeTiming();
+        }
+    }
+    setLatencyCounters(state, samples);
+}
+BENCHMARK_TEMPLATE(BM_HashInsertLatency, dsa::HashMap<int, int>)->Iterations(1 << 21);
+BENCHMARK_TEMPLATE(BM_HashInsertLatency, dsa::IncrementalHashMap<int, int>)->Iterations(1 << 21);
+BENCHMARK_TEMPLATE(BM_HashInsertLatency, std::unordered_map<int, int>)->Iterations(1 << 21);
+
+// The baseline ConcurrentHashMap replaces: one HashMap behind one mutex.
+struct LockedHashMap {
+    dsa::HashMap<std::string, int> map;
+    std::mutex mutex;
+
+    bool get(const std::string& key, int& value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        return map.get(key, value);
+    }
+    void put(const std::string& key, int value) {
+        std::lock_guard<std::mutex> lock(mutex);
+        map.put(key, value);
+    }
+};
+
+// Every thread reads (range(0) percent of operations) or overwrites random
+// keys of a shared map of 2^16 strings.
+template<typename Map>
+static void BM_ConcurrentHashMix(benchmark::State& state) {
+    static Map* shared = nullptr;
+    static std::vector<std::string> keys;
+    const std::size_t n = 1 << 16;
+    if (state.thread_index() == 0) {
+        keys.clear();
+        for (int k : makeHashKeys(n))
+            keys.push_back("key:" + std::to_string(k));
+        shared = new Map();
+        for (const std::string& key : keys)
+            shared->put(key, 0);
+    }
+    const unsigned readPercent = static_cast<unsigned>(state.range(0));
+    std::mt19937 rng(static_cast<unsigned>(state.thread_index()) + 1);
+    int value = 0;
+    for (auto _ : state) {
+        const std::string& key = keys[rng() & (n - 1)];
+        if (rng() % 100 < readPercent)
+            benchmark::DoNotOptimize(shared->get(key, value));
+        else
+            shared->put(key, value + 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0) {
+        delete shared;
+        shared = nullptr;
+    }
+}
+BENCHMARK_TEMPLATE(BM_ConcurrentHashMix, dsa::ConcurrentHashMap<std::string, int>)
+    ->Arg(100)->Arg(95)->Arg(50)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ConcurrentHashMix, LockedHashMap)
+    ->Arg(100)->Arg(95)->Arg(50)->ThreadRange(1, 32)->UseRealTime();
+
+static void hashFreeze(dsa::FrozenHashMap<int, int>& map, const dsa::HashMap<int, int>& source) {
+    map = dsa::FrozenHashMap<int, int>(source);
+}
+template<typename Layout>
+static void hashFreeze(dsa::HashMap<int, int, Layout>& map, const dsa::HashMap<int, int>& source) {
+    source.for_each([&map](int key, int value) { map.put(key, value); });
+}
+static bool hashFind(const dsa::FrozenHashMap<int, int>& map, int key) { return map.find(key) != nullptr; }
+
+// Looks up random present keys in a map of range(0) entries built from a
+// fixed key set, and reports heap bytes per entry; the frozen map also
+// reports the bits per key its perfect hash costs.
+template<typename Map>
+static void BM_FrozenHashLookup(benchmark::State& state) {
+    std::vector<int> keys = makeHashKeys(state.range(0));
+    dsa::HashMap<int, int> source;
+    for (int k : keys)
+        source.put(k, k);
+    double before = heapInUse();
+    Map map;
+    hashFreeze(map, source);
+    state.counters["bytes_per_entry"] = (heapInUse() - before) / source.size();
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(7));
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hashFind(map, keys[i]));
+        i = i + 1 == keys.size() ? 0 : i + 1;
+    }
+    if constexpr (std::is_same<Map, dsa::FrozenHashMap<int, int>>::value)
+        state.counters["bits_per_key"] = map.bits_per_key();
+}
+BENCHMARK_TEMPLATE(BM_FrozenHashLookup, dsa::FrozenHashMap<int, int>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_FrozenHashLookup, dsa::HashMap<int, int>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_FrozenHashLookup, dsa::SwissHashMap<int, int>)->Range(1 << 10, 1 << 22);
+
 BENCHMARK_MAIN(); 
\ No newline at end of file
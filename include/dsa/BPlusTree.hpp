@@ -0,0 +1,736 @@
+/**
+ * @file BPlusTree.hpp
+ * @brief Defines a cache-conscious B+tree ordered map.
+ *
+ * Every node occupies NodeBytes bytes (a multiple of the cache line size)
+ * and holds as many keys as fit, so one lookup touches O(log_B n) nodes
+ * instead of O(log2 n) pointer-linked TreeNodes. Keys are kept in their own
+ * contiguous array inside each node and searched without data-dependent
+ * branches. All entries live in the leaves, which are doubly linked so that
+ * range scans stream through memory without returning to the inner nodes.
+ *
+ * @section Complexity
+ * - insert/find/remove: O(log_B n) node visits, B = keys per node
+ * - lower_bound: O(log_B n)
+ * - scan over k entries: O(log_B n + k)
+ *
+ * @section Example
+ * @code
+ * dsa::BPlusTree<int, int> index;
+ * index.insert(42, 7);
+ * if (const int* v = index.find(42)) { ... }
+ * index.scan(10, 100, [](int key, int value) { ... });  // keys in [10, 100)
+ * for (auto [key, value] : index) { ... }               // all entries in order
+ * @endcode
+ */
+
+#ifndef DSA_BPLUSTREE_HPP
+#define DSA_BPLUSTREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "Utilities.hpp"
+
+namespace dsa {
+
+/**
+ * @class BPlusTree
+ * @brief An ordered map from Key to Value stored in a B+tree.
+ *
+ * @tparam Key Type of keys. Must be copyable and ordered by operator<.
+ * @tparam Value Type of values. Must be default constructible and copyable.
+ * @tparam NodeBytes Size of every node in bytes; a multiple of cacheLineSize.
+ */
+template<typename Key, typename Value, std::size_t NodeBytes = 4 * cacheLineSize>
+class BPlusTree {
+    static_assert(NodeBytes % cacheLineSize == 0, "NodeBytes must be a multiple of the cache line size");
+
+    /**
+     * Common header of leaf and inner nodes. It is not over-aligned itself,
+     * so the members of Leaf and Inner follow it directly on every ABI; the
+     * derived nodes carry the cache line alignment.
+     */
+    struct Node {
+        std::uint16_t count; ///< Number of keys in the node.
+        bool leaf;           ///< True for leaves.
+        explicit Node(bool isLeaf) : count(0), leaf(isLeaf) {}
+    };
+
+    static constexpr std::size_t alignUp(std::size_t n, std::size_t a) { return (n + a - 1) / a * a; }
+
+    /// Bytes a Leaf with @p c entries spans, padding included.
+    static constexpr std::size_t leafBytes(std::size_t c) {
+        std::size_t links = alignUp(sizeof(Node), alignof(Node*)) + 2 * sizeof(Node*);
+        return alignUp(alignUp(links, alignof(Key)) + c * sizeof(Key), alignof(Value)) + c * sizeof(Value);
+    }
+    /// Bytes an Inner with @p c keys spans, padding included.
+    static constexpr std::size_t innerBytes(std::size_t c) {
+        std::size_t keys = alignUp(sizeof(Node), alignof(Key)) + c * sizeof(Key);
+        return alignUp(keys, alignof(Node*)) + (c + 1) * sizeof(Node*);
+    }
+    /// Most entries whose leaf fits in NodeBytes.
+    static constexpr std::size_t fitLeaf() {
+        std::size_t c = (NodeBytes - sizeof(Node)) / (sizeof(Key) + sizeof(Value));
+        while (c > 0 && leafBytes(c) > NodeBytes)
+            --c;
+        return c;
+    }
+    /// Most separator keys whose inner node fits in NodeBytes.
+    static constexpr std::size_t fitInner() {
+        std::size_t c = (NodeBytes - sizeof(Node) - sizeof(Node*)) / (sizeof(Key) + sizeof(Node*));
+        while (c > 0 && innerBytes(c) > NodeBytes)
+            --c;
+        return c;
+    }
+
+public:
+    /// Maximum number of entries per leaf.
+    static constexpr std::size_t leafCapacity = fitLeaf();
+    /// Maximum number of separator keys per inner node.
+    static constexpr std::size_t innerCapacity = fitInner();
+
+    static_assert(leafCapacity >= 3 && innerCapacity >= 3, "NodeBytes too small for Key/Value");
+    static_assert(leafCapacity <= 0xFFFF && innerCapacity <= 0xFFFF, "NodeBytes too large");
+
+private:
+    /// Leaf node: sorted entries plus links to its neighbours.
+    struct alignas(cacheLineSize) Leaf : Node {
+        Leaf* prev;                 ///< Previous leaf in key order.
+        Leaf* next;                 ///< Next leaf in key order.
+        Key keys[leafCapacity];     ///< Sorted keys.
+        Value values[leafCapacity]; ///< Value of each key.
+        Leaf() : Node(true), prev(nullptr), next(nullptr) {}
+    };
+
+    /// Inner node: keys[i] is the smallest key reachable through children[i + 1].
+    struct alignas(cacheLineSize) Inner : Node {
+        Key keys[innerCapacity];           ///< Separator keys.
+        Node* children[innerCapacity + 1]; ///< count + 1 children.
+        Inner() : Node(false) {}
+    };
+
+    static_assert(sizeof(Leaf) <= NodeBytes, "Leaf layout exceeds NodeBytes");
+    static_assert(sizeof(Inner) <= NodeBytes, "Inner layout exceeds NodeBytes");
+
+public:
+    /**
+     * @brief Forward iterator over entries in key order.
+     *
+     * Keys and values sit in separate arrays inside each leaf, so there is no
+     * stored pair to point at: dereferencing yields a pair of references,
+     * which works with range-for and structured bindings.
+     *
+     * @tparam Const True for const_iterator, whose values are read-only.
+     */
+    template<bool Const>
+    class Iterator {
+        using ValueRef = typename std::conditional<Const, const Value&, Value&>::type;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<const Key, Value>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = std::pair<const Key&, ValueRef>;
+
+        /// Holds the pair that operator-> points into.
+        struct pointer {
+            reference entry; ///< Key and value of the entry.
+            /// Access operator.
+            const reference* operator->() const { return &entry; }
+        };
+
+        /// Constructs a singular iterator.
+        Iterator() : leaf_(nullptr), index_(0) {}
+
+        /// Converts an iterator to a const_iterator.
+        template<bool C = Const, typename = typename std::enable_if<C>::type>
+        Iterator(const Iterator<false>& other) : leaf_(other.leaf_), index_(other.index_) {}
+
+        /// Returns the key of the current entry.
+        const Key& key() const { return leaf_->keys[index_]; }
+        /// Returns the value of the current entry.
+        ValueRef value() const { return leaf_->values[index_]; }
+
+        /// Dereferences the iterator into a (key, value) pair of references.
+        reference operator*() const { return reference(key(), value()); }
+        /// Access operator.
+        pointer operator->() const { return pointer{**this}; }
+
+        /// Prefix increment operator.
+        Iterator& operator++() {
+            if (++index_ == leaf_->count) {
+                leaf_ = leaf_->next;
+                index_ = 0;
+            }
+            return *this;
+        }
+        /// Postfix increment operator.
+        Iterator operator++(int) { Iterator temp = *this; ++(*this); return temp; }
+
+        /// Equality comparison operator.
+        bool operator==(const Iterator& other) const {
+            return leaf_ == other.leaf_ && index_ == other.index_;
+        }
+        /// Inequality comparison operator.
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+    private:
+        Iterator(Leaf* leaf, std::size_t index) : leaf_(leaf), index_(index) {}
+        Leaf* leaf_;        ///< Current leaf; null at end().
+        std::size_t index_; ///< Entry within the leaf.
+        friend class BPlusTree;
+        friend class Iterator<!Const>;
+    };
+
+    /// Mutable iterator; keys are const, values may be modified.
+    using iterator = Iterator<false>;
+    /// Read-only iterator.
+    using const_iterator = Iterator<true>;
+
+    /// Default constructor.
+    BPlusTree() : root_(nullptr), head_(nullptr), size_(0) {}
+    /// Copy constructor.
+    BPlusTree(const BPlusTree& other);
+    /// Move constructor.
+    BPlusTree(BPlusTree&& other) noexcept;
+    /**
+     * @brief Copy assignment operator.
+     * @param other Another tree.
+     * @return Reference to this tree.
+     */
+    BPlusTree& operator=(BPlusTree other);
+    /// Destructor.
+    ~BPlusTree() { destroy(root_); }
+
+    /**
+     * @brief Inserts a key-value pair, or updates the value if the key exists.
+     * @return True if a new entry was added.
+     */
+    bool insert(const Key& key, const Value& value);
+
+    /**
+     * @brief Looks up a key.
+     * @return Pointer to the value, or nullptr if the key is absent.
+     */
+    Value* find(const Key& key);
+    /// Const version of find().
+    const Value* find(const Key& key) const;
+
+    /// Checks whether a key is present.
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Removes a key.
+     * @return True if the key was present.
+     */
+    bool remove(const Key& key);
+
+    /// Returns an iterator to the first entry whose key is not less than @p key.
+    iterator lower_bound(const Key& key) { return iterator(lowerBoundEntry(key)); }
+    /// Const version of lower_bound().
+    const_iterator lower_bound(const Key& key) const { return const_iterator(lowerBoundEntry(key)); }
+
+    /**
+     * @brief Calls f(key, value) for every entry with lo <= key < hi, in order.
+     * @return Number of entries visited.
+     */
+    template<typename Func>
+    std::size_t scan(const Key& lo, const Key& hi, Func f) const;
+
+    /// Returns iterator to the smallest entry.
+    iterator begin() { return iterator(head_, 0); }
+    /// Const version of begin().
+    const_iterator begin() const { return const_iterator(head_, 0); }
+    /// Returns iterator representing the end of the entries.
+    iterator end() { return iterator(nullptr, 0); }
+    /// Const version of end().
+    const_iterator end() const { return const_iterator(nullptr, 0); }
+
+    /// Returns the number of entries.
+    std::size_t size() const { return size_; }
+    /// Checks if the tree is empty.
+    bool empty() const { return size_ == 0; }
+
+    /// Removes all entries.
+    void clear();
+
+private:
+    /// Result of inserting into a subtree: a new right sibling to link in, if any.
+    struct Split {
+        Node* right;   ///< New node, or null if no split happened.
+        Key separator; ///< Smallest key reachable through @c right.
+    };
+
+    Node* root_;       ///< Root node; null when empty.
+    Leaf* head_;       ///< Leftmost leaf; null when empty.
+    std::size_t size_; ///< Number of entries.
+
+    /// Index of the first key in keys[0..n) that is not less than key.
+    static std::size_t lowerBound(const Key* keys, std::size_t n, const Key& key);
+    /// Index of the first key in keys[0..n) that is greater than key.
+    static std::size_t upperBound(const Key* keys, std::size_t n, const Key& key);
+    /// Descends to the leaf that may contain key.
+    Leaf* findLeaf(const Key& key) const;
+    /// First entry whose key is not less than @p key, as an end() iterator when none is.
+    iterator lowerBoundEntry(const Key& key) const;
+
+    Split insert(Node* node, const Key& key, const Value& value, bool& inserted);
+    Split insertIntoInner(Inner* node, std::size_t slot, const Split& split);
+    bool remove(Node* node, const Key& key);
+    /// Restores minimum occupancy of parent->children[i] after a removal.
+    void fixUnderflow(Inner* parent, std::size_t i);
+    /// Removes parent's key i and child i + 1.
+    static void removeFromInner(Inner* parent, std::size_t i);
+
+    static void destroy(Node* node);
+    /// Deep copy of a subtree; appends its leaves to the chain ending at tail.
+    static Node* clone(const Node* node, Leaf*& tail, Leaf*& head);
+};
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+std::size_t BPlusTree<Key, Value, NodeBytes>::lowerBound(const Key* keys, std::size_t n, const Key& key) {
+    if constexpr (std::is_arithmetic<Key>::value) {
+        // Counting loop over a contiguous key array: no branches on the data,
+        // and compilers turn it into SIMD compares for arithmetic keys.
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            pos += keys[i] < key;
+        return pos;
+    }
+    // Branchless binary search: the ternary compiles to a conditional move.
+    if (n == 0)
+        return 0;
+    const Key* base = keys;
+    while (n > 1) {
+        std::size_t half = n / 2;
+        base = base[half - 1] < key ? base + half : base;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - keys) + (*base < key);
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+std::size_t BPlusTree<Key, Value, NodeBytes>::upperBound(const Key* keys, std::size_t n, const Key& key) {
+    if constexpr (std::is_arithmetic<Key>::value) {
+        std::size_t pos = 0;
+        for (std::size_t i = 0; i < n; ++i)
+            pos += !(key < keys[i]);
+        return pos;
+    }
+    if (n == 0)
+        return 0;
+    const Key* base = keys;
+    while (n > 1) {
+        std::size_t half = n / 2;
+        base = key < base[half - 1] ? base : base + half;
+        n -= half;
+    }
+    return static_cast<std::size_t>(base - keys) + !(key < *base);
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+typename BPlusTree<Key, Value, NodeBytes>::Leaf*
+BPlusTree<Key, Value, NodeBytes>::findLeaf(const Key& key) const {
+    Node* node = root_;
+    if (!node)
+        return nullptr;
+    while (!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        node = inner->children[upperBound(inner->keys, inner->count, key)];
+    }
+    return static_cast<Leaf*>(node);
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+Value* BPlusTree<Key, Value, NodeBytes>::find(const Key& key) {
+    Leaf* leaf = findLeaf(key);
+    if (!leaf)
+        return nullptr;
+    std::size_t i = lowerBound(leaf->keys, leaf->count, key);
+    if (i < leaf->count && !(key < leaf->keys[i]))
+        return &leaf->values[i];
+    return nullptr;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+const Value* BPlusTree<Key, Value, NodeBytes>::find(const Key& key) const {
+    return const_cast<BPlusTree*>(this)->find(key);
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+typename BPlusTree<Key, Value, NodeBytes>::iterator
+BPlusTree<Key, Value, NodeBytes>::lowerBoundEntry(const Key& key) const {
+    Leaf* leaf = findLeaf(key);
+    if (!leaf)
+        return iterator(nullptr, 0);
+    std::size_t i = lowerBound(leaf->keys, leaf->count, key);
+    if (i == leaf->count)
+        return iterator(leaf->next, 0);
+    return iterator(leaf, i);
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+template<typename Func>
+std::size_t BPlusTree<Key, Value, NodeBytes>::scan(const Key& lo, const Key& hi, Func f) const {
+    Leaf* leaf = findLeaf(lo);
+    if (!leaf)
+        return 0;
+    std::size_t visited = 0;
+    std::size_t i = lowerBound(leaf->keys, leaf->count, lo);
+    for (; leaf; leaf = leaf->next, i = 0) {
+        for (; i < leaf->count; ++i) {
+            if (!(leaf->keys[i] < hi))
+                return visited;
+            f(leaf->keys[i], leaf->values[i]);
+            ++visited;
+        }
+    }
+    return visited;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+bool BPlusTree<Key, Value, NodeBytes>::insert(const Key& key, const Value& value) {
+    if (!root_) {
+        Leaf* leaf = new Leaf();
+        root_ = head_ = leaf;
+    }
+    bool inserted = false;
+    Split split = insert(root_, key, value, inserted);
+    if (split.right) {
+        Inner* root = new Inner();
+        root->count = 1;
+        root->keys[0] = split.separator;
+        root->children[0] = root_;
+        root->children[1] = split.right;
+        root_ = root;
+    }
+    if (inserted)
+        ++size_;
+    return inserted;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+typename BPlusTree<Key, Value, NodeBytes>::Split
+BPlusTree<Key, Value, NodeBytes>::insert(Node* node, const Key& key, const Value& value, bool& inserted) {
+    if (!node->leaf) {
+        Inner* inner = static_cast<Inner*>(node);
+        std::size_t slot = upperBound(inner->keys, inner->count, key);
+        Split split = insert(inner->children[slot], key, value, inserted);
+        if (!split.right)
+            return split;
+        return insertIntoInner(inner, slot, split);
+    }
+
+    Leaf* leaf = static_cast<Leaf*>(node);
+    std::size_t pos = lowerBound(leaf->keys, leaf->count, key);
+    if (pos < leaf->count && !(key < leaf->keys[pos])) {
+        leaf->values[pos] = value;
+        return Split{nullptr, Key()};
+    }
+    inserted = true;
+    if (leaf->count < leafCapacity) {
+        for (std::size_t i = leaf->count; i > pos; --i) {
+            leaf->keys[i] = leaf->keys[i - 1];
+            leaf->values[i] = leaf->values[i - 1];
+        }
+        leaf->keys[pos] = key;
+        leaf->values[pos] = value;
+        ++leaf->count;
+        return Split{nullptr, Key()};
+    }
+
+    // Full leaf: move the upper half to a new right sibling, then insert.
+    Leaf* right = new Leaf();
+    const std::size_t keep = (leafCapacity + 1) / 2;
+    for (std::size_t i = keep; i < leafCapacity; ++i) {
+        right->keys[i - keep] = leaf->keys[i];
+        right->values[i - keep] = leaf->values[i];
+    }
+    right->count = static_cast<std::uint16_t>(leafCapacity - keep);
+    leaf->count = static_cast<std::uint16_t>(keep);
+    right->next = leaf->next;
+    if (right->next)
+        right->next->prev = right;
+    right->prev = leaf;
+    leaf->next = right;
+
+    Leaf* target = pos <= keep ? leaf : right;
+    if (target == right)
+        pos -= keep;
+    for (std::size_t i = target->count; i > pos; --i) {
+        target->keys[i] = target->keys[i - 1];
+        target->values[i] = target->values[i - 1];
+    }
+    target->keys[pos] = key;
+    target->values[pos] = value;
+    ++target->count;
+    return Split{right, right->keys[0]};
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+typename BPlusTree<Key, Value, NodeBytes>::Split
+BPlusTree<Key, Value, NodeBytes>::insertIntoInner(Inner* node, std::size_t slot, const Split& split) {
+    if (node->count < innerCapacity) {
+        for (std::size_t i = node->count; i > slot; --i) {
+            node->keys[i] = node->keys[i - 1];
+            node->children[i + 1] = node->children[i];
+        }
+        node->keys[slot] = split.separator;
+        node->children[slot + 1] = split.right;
+        ++node->count;
+        return Split{nullptr, Key()};
+    }
+
+    // Full inner node: merge into scratch arrays, then split around the middle key.
+    Key keys[innerCapacity + 1];
+    Node* children[innerCapacity + 2];
+    for (std::size_t i = 0, j = 0; i <= innerCapacity; ++i)
+        keys[i] = i == slot ? split.separator : node->keys[j++];
+    for (std::size_t i = 0, j = 0; i <= innerCapacity + 1; ++i)
+        children[i] = i == slot + 1 ? split.right : node->children[j++];
+
+    const std::size_t mid = (innerCapacity + 1) / 2;
+    Inner* right = new Inner();
+    node->count = static_cast<std::uint16_t>(mid);
+    for (std::size_t i = 0; i < mid; ++i) {
+        node->keys[i] = keys[i];
+        node->children[i] = children[i];
+    }
+    node->children[mid] = children[mid];
+    right->count = static_cast<std::uint16_t>(innerCapacity - mid);
+    for (std::size_t i = mid + 1; i <= innerCapacity; ++i) {
+        right->keys[i - mid - 1] = keys[i];
+        right->children[i - mid - 1] = children[i];
+    }
+    right->children[right->count] = children[innerCapacity + 1];
+    return Split{right, keys[mid]};
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+bool BPlusTree<Key, Value, NodeBytes>::remove(const Key& key) {
+    if (!root_ || !remove(root_, key))
+        return false;
+    --size_;
+    if (!root_->leaf && root_->count == 0) {
+        // The root lost its last separator: its only child becomes the root.
+        Inner* old = static_cast<Inner*>(root_);
+        root_ = old->children[0];
+        delete old;
+    } else if (root_->leaf && root_->count == 0) {
+        delete static_cast<Leaf*>(root_);
+        root_ = nullptr;
+        head_ = nullptr;
+    }
+    return true;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+bool BPlusTree<Key, Value, NodeBytes>::remove(Node* node, const Key& key) {
+    if (node->leaf) {
+        Leaf* leaf = static_cast<Leaf*>(node);
+        std::size_t pos = lowerBound(leaf->keys, leaf->count, key);
+        if (pos == leaf->count || key < leaf->keys[pos])
+            return false;
+        for (std::size_t i = pos + 1; i < leaf->count; ++i) {
+            leaf->keys[i - 1] = leaf->keys[i];
+            leaf->values[i - 1] = leaf->values[i];
+        }
+        --leaf->count;
+        return true;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    std::size_t slot = upperBound(inner->keys, inner->count, key);
+    if (!remove(inner->children[slot], key))
+        return false;
+    Node* child = inner->children[slot];
+    std::size_t minimum = child->leaf ? leafCapacity / 2 : innerCapacity / 2;
+    if (child->count < minimum)
+        fixUnderflow(inner, slot);
+    return true;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+void BPlusTree<Key, Value, NodeBytes>::removeFromInner(Inner* parent, std::size_t i) {
+    for (std::size_t j = i + 1; j < parent->count; ++j) {
+        parent->keys[j - 1] = parent->keys[j];
+        parent->children[j] = parent->children[j + 1];
+    }
+    --parent->count;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+void BPlusTree<Key, Value, NodeBytes>::fixUnderflow(Inner* parent, std::size_t i) {
+    Node* child = parent->children[i];
+    Node* left = i > 0 ? parent->children[i - 1] : nullptr;
+    Node* right = i < parent->count ? parent->children[i + 1] : nullptr;
+
+    if (child->leaf) {
+        const std::size_t minimum = leafCapacity / 2;
+        Leaf* c = static_cast<Leaf*>(child);
+        Leaf* l = static_cast<Leaf*>(left);
+        Leaf* r = static_cast<Leaf*>(right);
+        if (l && l->count > minimum) {
+            // Borrow the largest entry of the left sibling.
+            for (std::size_t j = c->count; j > 0; --j) {
+                c->keys[j] = c->keys[j - 1];
+                c->values[j] = c->values[j - 1];
+            }
+            --l->count;
+            c->keys[0] = l->keys[l->count];
+            c->values[0] = l->values[l->count];
+            ++c->count;
+            parent->keys[i - 1] = c->keys[0];
+        } else if (r && r->count > minimum) {
+            // Borrow the smallest entry of the right sibling.
+            c->keys[c->count] = r->keys[0];
+            c->values[c->count] = r->values[0];
+            ++c->count;
+            for (std::size_t j = 1; j < r->count; ++j) {
+                r->keys[j - 1] = r->keys[j];
+                r->values[j - 1] = r->values[j];
+            }
+            --r->count;
+            parent->keys[i] = r->keys[0];
+        } else {
+            // Merge the right one of the pair into the left one.
+            Leaf* dst = l ? l : c;
+            Leaf* src = l ? c : r;
+            std::size_t sep = l ? i - 1 : i;
+            for (std::size_t j = 0; j < src->count; ++j) {
+                dst->keys[dst->count + j] = src->keys[j];
+                dst->values[dst->count + j] = src->values[j];
+            }
+            dst->count = static_cast<std::uint16_t>(dst->count + src->count);
+            dst->next = src->next;
+            if (dst->next)
+                dst->next->prev = dst;
+            delete src;
+            removeFromInner(parent, sep);
+        }
+        return;
+    }
+
+    const std::size_t minimum = innerCapacity / 2;
+    Inner* c = static_cast<Inner*>(child);
+    Inner* l = static_cast<Inner*>(left);
+    Inner* r = static_cast<Inner*>(right);
+    if (l && l->count > minimum) {
+        // Rotate through the parent: separator down, left's last key up.
+        c->children[c->count + 1] = c->children[c->count];
+        for (std::size_t j = c->count; j > 0; --j) {
+            c->keys[j] = c->keys[j - 1];
+            c->children[j] = c->children[j - 1];
+        }
+        c->keys[0] = parent->keys[i - 1];
+        c->children[0] = l->children[l->count];
+        ++c->count;
+        parent->keys[i - 1] = l->keys[l->count - 1];
+        --l->count;
+    } else if (r && r->count > minimum) {
+        c->keys[c->count] = parent->keys[i];
+        c->children[c->count + 1] = r->children[0];
+        ++c->count;
+        parent->keys[i] = r->keys[0];
+        for (std::size_t j = 1; j < r->count; ++j) {
+            r->keys[j - 1] = r->keys[j];
+            r->children[j - 1] = r->children[j];
+        }
+        r->children[r->count - 1] = r->children[r->count];
+        --r->count;
+    } else {
+        Inner* dst = l ? l : c;
+        Inner* src = l ? c : r;
+        std::size_t sep = l ? i - 1 : i;
+        dst->keys[dst->count] = parent->keys[sep];
+        for (std::size_t j = 0; j < src->count; ++j) {
+            dst->keys[dst->count + 1 + j] = src->keys[j];
+            dst->children[dst->count + 1 + j] = src->children[j];
+        }
+        dst->children[dst->count + 1 + src->count] = src->children[src->count];
+        dst->count = static_cast<std::uint16_t>(dst->count + 1 + src->count);
+        delete src;
+        removeFromInner(parent, sep);
+    }
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+void BPlusTree<Key, Value, NodeBytes>::destroy(Node* node) {
+    if (!node)
+        return;
+    if (node->leaf) {
+        delete static_cast<Leaf*>(node);
+        return;
+    }
+    Inner* inner = static_cast<Inner*>(node);
+    for (std::size_t i = 0; i <= inner->count; ++i)
+        destroy(inner->children[i]);
+    delete inner;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+void BPlusTree<Key, Value, NodeBytes>::clear() {
+    destroy(root_);
+    root_ = nullptr;
+    head_ = nullptr;
+    size_ = 0;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+typename BPlusTree<Key, Value, NodeBytes>::Node*
+BPlusTree<Key, Value, NodeBytes>::clone(const Node* node, Leaf*& tail, Leaf*& head) {
+    if (node->leaf) {
+        const Leaf* src = static_cast<const Leaf*>(node);
+        Leaf* copy = new Leaf();
+        copy->count = src->count;
+        for (std::size_t i = 0; i < src->count; ++i) {
+            copy->keys[i] = src->keys[i];
+            copy->values[i] = src->values[i];
+        }
+        copy->prev = tail;
+        if (tail)
+            tail->next = copy;
+        else
+            head = copy;
+        tail = copy;
+        return copy;
+    }
+    const Inner* src = static_cast<const Inner*>(node);
+    Inner* copy = new Inner();
+    copy->count = src->count;
+    for (std::size_t i = 0; i < src->count; ++i)
+        copy->keys[i] = src->keys[i];
+    for (std::size_t i = 0; i <= src->count; ++i)
+        copy->children[i] = clone(src->children[i], tail, head);
+    return copy;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+BPlusTree<Key, Value, NodeBytes>::BPlusTree(const BPlusTree& other)
+    : root_(nullptr), head_(nullptr), size_(other.size_) {
+    Leaf* tail = nullptr;
+    if (other.root_)
+        root_ = clone(other.root_, tail, head_);
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+BPlusTree<Key, Value, NodeBytes>::BPlusTree(BPlusTree&& other) noexcept
+    : root_(other.root_), head_(other.head_), size_(other.size_) {
+    other.root_ = nullptr;
+    other.head_ = nullptr;
+    other.size_ = 0;
+}
+
+template<typename Key, typename Value, std::size_t NodeBytes>
+BPlusTree<Key, Value, NodeBytes>& BPlusTree<Key, Value, NodeBytes>::operator=(BPlusTree other) {
+    std::swap(root_, other.root_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    return *this;
+}
+
+} // namespace dsa
+
+#endif // DSA_BPLUSTREE_HPP
@@ -0,0 +1,238 @@
+/**
+ * @file BlockingQueue.hpp
+ * @brief Defines a thread-safe FIFO queue whose consumers can block.
+ *
+ * BlockingQueue wraps a dsa::Queue behind a mutex and lets consumers wait
+ * for data instead of polling empty(). A waiting consumer first spins
+ * briefly on a lock-free size hint and only then parks on a condition
+ * variable. Producers notify only as many sleepers as are not already being
+ * woken, so a burst of enqueues wakes each parked consumer at most once.
+ *
+ * @section Complexity
+ * - push/try_pop/pop_wait: O(1) plus locking
+ * - drain_to: O(k) for k removed elements under a single lock
+ *
+ * @section Example
+ * @code
+ * dsa::BlockingQueue<int> queue;
+ * // producer
+ * queue.push(1);
+ * queue.close();
+ * // consumer
+ * int x;
+ * while (queue.pop_wait(x, std::chrono::milliseconds(100))) { ... }
+ * @endcode
+ */
+
+#ifndef DSA_BLOCKINGQUEUE_HPP
+#define DSA_BLOCKINGQUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "Queue.hpp"
+
+namespace dsa {
+
+/**
+ * @class BlockingQueue
+ * @brief An unbounded, closable multi-producer/multi-consumer FIFO queue.
+ *
+ * @tparam T Type of elements.
+ * @tparam Container Storage used by the wrapped dsa::Queue.
+ *
+ * @section Thread Safety
+ * All member functions may be called concurrently from any thread.
+ */
+template<typename T, typename Container = LinkedList<T>>
+class BlockingQueue {
+public:
+    /**
+     * @brief Constructs an empty, open queue.
+     * @param spinLimit Number of times a consumer polls before parking.
+     */
+    explicit BlockingQueue(std::size_t spinLimit = 128)
+        : count_(0), closed_(false), sleepers_(0), signaled_(0), spinLimit_(spinLimit) {}
+
+    BlockingQueue(const BlockingQueue&) = delete;
+    BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+    /**
+     * @brief Appends an element and wakes a parked consumer if needed.
+     * @param value Element to be added.
+     * @return False if the queue has been closed; the element is dropped.
+     */
+    bool push(const T& value) { return pushOne(value); }
+
+    /**
+     * @brief Appends an element using move semantics.
+     * @param value Element to be added.
+     * @return False if the queue has been closed; the element is dropped.
+     */
+    bool push(T&& value) { return pushOne(std::move(value)); }
+
+    /**
+     * @brief Removes the front element if one is available, without waiting.
+     * @param out Receives the removed element.
+     * @return True if an element was removed.
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Removes the front element, waiting up to @p timeout for one.
+     *
+     * Spins on a size hint first, then parks on a condition variable.
+     *
+     * @param out Receives the removed element.
+     * @param timeout Maximum time to wait.
+     * @return True if an element was removed; false on timeout, or if the
+     *         queue is closed and empty.
+     */
+    template<typename Rep, typename Period>
+    bool pop_wait(T& out, const std::chrono::duration<Rep, Period>& timeout);
+
+    /**
+     * @brief Moves up to @p max available elements into @p batch.
+     *
+     * Does not wait; takes the lock once for the whole batch. Typically used
+     * right after a successful pop_wait().
+     *
+     * @tparam Batch Container with a push_back member (e.g. std::vector).
+     * @param batch Destination container; elements are appended.
+     * @param max Maximum number of elements to move.
+     * @return Number of elements moved.
+     */
+    template<typename Batch>
+    std::size_t drain_to(Batch& batch, std::size_t max);
+
+    /**
+     * @brief Closes the queue.
+     *
+     * Further pushes fail, and every waiting consumer is woken. Elements
+     * already queued can still be popped.
+     */
+    void close();
+
+    /// Returns true once close() has been called.
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+    /// Returns the number of queued elements at the time of the call.
+    std::size_t size() const { return count_.load(std::memory_order_acquire); }
+
+    /// Returns true if the queue appeared empty at the time of the call.
+    bool empty() const { return size() == 0; }
+
+private:
+    /// Shared implementation of the push overloads.
+    template<typename U>
+    bool pushOne(U&& value);
+
+    /// Removes the front element; the caller holds mutex_ and the queue is non-empty.
+    void popLocked(T& out);
+
+    Queue<T, Container> queue_;         ///< Wrapped storage, guarded by mutex_.
+    mutable std::mutex mutex_;          ///< Guards queue_, sleepers_ and signaled_.
+    std::condition_variable notEmpty_;  ///< Signaled when data arrives or on close.
+    std::atomic<std::size_t> count_;    ///< Lock-free size hint for spinning consumers.
+    std::atomic<bool> closed_;          ///< Set by close().
+    std::size_t sleepers_;              ///< Consumers parked on notEmpty_.
+    std::size_t signaled_;              ///< Sleepers already notified but not yet awake.
+    const std::size_t spinLimit_;       ///< Polls before parking.
+};
+
+template<typename T, typename Container>
+template<typename U>
+bool BlockingQueue<T, Container>::pushOne(U&& value) {
+    bool wake = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_.load(std::memory_order_relaxed))
+            return false;
+        queue_.enqueue(std::forward<U>(value));
+        count_.fetch_add(1, std::memory_order_release);
+        // Only wake a sleeper nobody else has already signaled.
+        if (sleepers_ > signaled_) {
+            ++signaled_;
+            wake = true;
+        }
+    }
+    if (wake)
+        notEmpty_.notify_one();
+    return true;
+}
+
+template<typename T, typename Container>
+void BlockingQueue<T, Container>::popLocked(T& out) {
+    out = std::move(queue_.front());
+    queue_.dequeue();
+    count_.fetch_sub(1, std::memory_order_release);
+}
+
+template<typename T, typename Container>
+bool BlockingQueue<T, Container>::try_pop(T& out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty())
+        return false;
+    popLocked(out);
+    return true;
+}
+
+template<typename T, typename Container>
+template<typename Rep, typename Period>
+bool BlockingQueue<T, Container>::pop_wait(T& out, const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+    // Spin phase: avoid the cost of parking when data is about to arrive.
+    for (std::size_t i = 0; i < spinLimit_; ++i) {
+        if (count_.load(std::memory_order_acquire) != 0 || closed())
+            break;
+        std::this_thread::yield();
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (queue_.empty()) {
+        if (closed_.load(std::memory_order_relaxed))
+            return false;
+        ++sleepers_;
+        std::cv_status status = notEmpty_.wait_until(lock, deadline);
+        --sleepers_;
+        if (signaled_ > 0)
+            --signaled_;
+        if (status == std::cv_status::timeout && queue_.empty())
+            return false;
+    }
+    popLocked(out);
+    return true;
+}
+
+template<typename T, typename Container>
+template<typename Batch>
+std::size_t BlockingQueue<T, Container>::drain_to(Batch& batch, std::size_t max) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t n = 0;
+    while (n < max && !queue_.empty()) {
+        batch.push_back(std::move(queue_.front()));
+        queue_.dequeue();
+        ++n;
+    }
+    count_.fetch_sub(n, std::memory_order_release);
+    return n;
+}
+
+template<typename T, typename Container>
+void BlockingQueue<T, Container>::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_.store(true, std::memory_order_release);
+        signaled_ = sleepers_;
+    }
+    notEmpty_.notify_all();
+}
+
+} // namespace dsa
+
+#endif // DSA_BLOCKINGQUEUE_HPP
@@ -0,0 +1,395 @@
+/**
+ * @file CompactTree.hpp
+ * @brief Defines an AVL search tree whose nodes live in one contiguous pool.
+ *
+ * Nodes are stored in a single array and refer to each other by 32-bit
+ * index instead of by pointer. For small keys this more than halves the
+ * per-element footprint of BinarySearchTree (20 bytes per int node instead
+ * of 48) and keeps nodes adjacent in memory. The pool is kept dense: a
+ * removed node's slot is refilled with the last node, so copying the tree
+ * is a single array copy and destroying it is a single deallocation.
+ *
+ * @section Complexity
+ * - insert/remove/search: O(log n)
+ * - copy: O(n) with one allocation; destruction: one deallocation
+ * - iterator ++/--: amortized O(1)
+ *
+ * @section Example
+ * @code
+ * dsa::CompactTree<int> tree;
+ * tree.reserve(1000);
+ * for (int i = 0; i < 1000; ++i)
+ *     tree.insert(i);
+ * for (int x : tree) { ... }
+ * @endcode
+ */
+
+#ifndef DSA_COMPACTTREE_HPP
+#define DSA_COMPACTTREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace dsa {
+
+/**
+ * @class CompactTree
+ * @brief A height-balanced (AVL) set stored in a contiguous node pool.
+ *
+ * Holds at most 2^32 - 1 elements. Elements are ordered with operator<
+ * only; duplicates are ignored.
+ *
+ * @tparam T Type of elements. Must be move constructible and move assignable.
+ */
+template<typename T>
+class CompactTree {
+public:
+    /// Index type used for child and parent links.
+    using index_type = std::uint32_t;
+
+private:
+    /// Link value meaning "no node".
+    static constexpr index_type nil = static_cast<index_type>(-1);
+
+    /// Pool entry: the element plus its links and AVL height.
+    struct Node {
+        T data;             ///< Stored element.
+        index_type left;    ///< Left child, or nil.
+        index_type right;   ///< Right child, or nil.
+        index_type parent;  ///< Parent, or nil for the root.
+        std::int32_t height; ///< Height of the subtree (a leaf has height 1).
+    };
+
+public:
+    /**
+     * @brief Bidirectional in-order iterator over the elements.
+     *
+     * insert() does not invalidate iterators; remove() invalidates all of them.
+     */
+    class const_iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const T*;
+        using reference         = const T&;
+
+        /// Constructs a singular iterator.
+        const_iterator() : tree_(nullptr), index_(nil) {}
+
+        /// Dereferences the iterator.
+        reference operator*() const { return tree_->nodes_[index_].data; }
+        /// Access operator.
+        pointer operator->() const { return &tree_->nodes_[index_].data; }
+
+        /// Prefix increment operator.
+        const_iterator& operator++() { index_ = tree_->successor(index_); return *this; }
+        /// Postfix increment operator.
+        const_iterator operator++(int) { const_iterator temp = *this; ++(*this); return temp; }
+
+        /// Prefix decrement operator; decrementing end() yields the largest element.
+        const_iterator& operator--() {
+            index_ = index_ == nil ? tree_->findMax(tree_->root_) : tree_->predecessor(index_);
+            return *this;
+        }
+        /// Postfix decrement operator.
+        const_iterator operator--(int) { const_iterator temp = *this; --(*this); return temp; }
+
+        /// Equality comparison operator.
+        bool operator==(const const_iterator& other) const { return index_ == other.index_; }
+        /// Inequality comparison operator.
+        bool operator!=(const const_iterator& other) const { return index_ != other.index_; }
+
+    private:
+        const_iterator(const CompactTree* tree, index_type index) : tree_(tree), index_(index) {}
+        const CompactTree* tree_; ///< Owning tree.
+        index_type index_;        ///< Current node; nil at end().
+        friend class CompactTree;
+    };
+
+    /// Default constructor.
+    CompactTree() : root_(nil) {}
+    /// Copy constructor: copies the pool with a single allocation.
+    CompactTree(const CompactTree& other) = default;
+    /// Move constructor.
+    CompactTree(CompactTree&& other) noexcept
+        : nodes_(std::move(other.nodes_)), root_(other.root_) {
+        other.nodes_.clear();
+        other.root_ = nil;
+    }
+    /**
+     * @brief Copy assignment operator.
+     * @param other Another tree.
+     * @return Reference to this tree.
+     */
+    CompactTree& operator=(CompactTree other) {
+        nodes_.swap(other.nodes_);
+        std::swap(root_, other.root_);
+        return *this;
+    }
+
+    /**
+     * @brief Inserts a value; does nothing if an equivalent value is present.
+     * @throws std::length_error if the tree already holds 2^32 - 1 elements.
+     */
+    void insert(const T& value);
+
+    /**
+     * @brief Removes a value.
+     * @param value Value to remove.
+     * @return True if removed, false if not found.
+     */
+    bool remove(const T& value);
+
+    /**
+     * @brief Searches for a value.
+     * @return True if found, false otherwise.
+     */
+    bool search(const T& value) const { return findIndex(value) != nil; }
+
+    /// Returns the number of elements.
+    std::size_t size() const { return nodes_.size(); }
+    /// Checks if the tree is empty.
+    bool empty() const { return nodes_.empty(); }
+    /// Returns the number of nodes on the longest root-to-leaf path.
+    std::size_t height() const { return static_cast<std::size_t>(heightOf(root_)); }
+
+    /// Preallocates pool space for @p count elements.
+    void reserve(std::size_t count) { nodes_.reserve(count); }
+    /// Returns the number of elements the pool can hold without reallocating.
+    std::size_t capacity() const { return nodes_.capacity(); }
+    /// Removes all elements, keeping the pool's capacity.
+    void clear() { nodes_.clear(); root_ = nil; }
+
+    /// Returns iterator to the smallest element.
+    const_iterator begin() const { return const_iterator(this, findMin(root_)); }
+    /// Returns iterator representing the end of the elements.
+    const_iterator end() const { return const_iterator(this, nil); }
+
+private:
+    std::vector<Node> nodes_; ///< Dense node pool; root_ indexes into it.
+    index_type root_;         ///< Root node, or nil when empty.
+
+    index_type findIndex(const T& value) const;
+    index_type findMin(index_type i) const;
+    index_type findMax(index_type i) const;
+    index_type successor(index_type i) const;
+    index_type predecessor(index_type i) const;
+
+    std::int32_t heightOf(index_type i) const { return i == nil ? 0 : nodes_[i].height; }
+    void updateHeight(index_type i);
+    /// Points whatever referred to oldChild (its parent or root_) at newChild.
+    void replaceChild(index_type parent, index_type oldChild, index_type newChild);
+    void rotateLeft(index_type x);
+    void rotateRight(index_type x);
+    /// Restores the AVL property at i; returns the index now rooting i's subtree.
+    index_type rebalance(index_type i);
+    /// Moves the last pool node into the vacated slot @p hole and shrinks the pool.
+    void fillHole(index_type hole);
+};
+
+template<typename T>
+typename CompactTree<T>::index_type CompactTree<T>::findIndex(const T& value) const {
+    index_type i = root_;
+    while (i != nil) {
+        const Node& n = nodes_[i];
+        if (value < n.data)
+            i = n.left;
+        else if (n.data < value)
+            i = n.right;
+        else
+            return i;
+    }
+    return nil;
+}
+
+template<typename T>
+typename CompactTree<T>::index_type CompactTree<T>::findMin(index_type i) const {
+    if (i == nil)
+        return nil;
+    while (nodes_[i].left != nil)
+        i = nodes_[i].left;
+    return i;
+}
+
+template<typename T>
+typename CompactTree<T>::index_type CompactTree<T>::findMax(index_type i) const {
+    if (i == nil)
+        return nil;
+    while (nodes_[i].right != nil)
+        i = nodes_[i].right;
+    return i;
+}
+
+template<typename T>
+typename CompactTree<T>::index_type CompactTree<T>::successor(index_type i) const {
+    if (nodes_[i].right != nil)
+        return findMin(nodes_[i].right);
+    index_type p = nodes_[i].parent;
+    while (p != nil && i == nodes_[p].right) {
+        i = p;
+        p = nodes_[p].parent;
+    }
+    return p;
+}
+
+template<typename T>
+typename CompactTree<T>::index_type CompactTree<T>::predecessor(index_type i) const {
+    if (nodes_[i].left != nil)
+        return findMax(nodes_[i].left);
+    index_type p = nodes_[i].parent;
+    while (p != nil && i == nodes_[p].left) {
+        i = p;
+        p = nodes_[p].parent;
+    }
+    return p;
+}
+
+template<typename T>
+void CompactTree<T>::updateHeight(index_type i) {
+    std::int32_t l = heightOf(nodes_[i].left), r = heightOf(nodes_[i].right);
+    nodes_[i].height = 1 + (l > r ? l : r);
+}
+
+template<typename T>
+void CompactTree<T>::replaceChild(index_type parent, index_type oldChild, index_type newChild) {
+    if (parent == nil)
+        root_ = newChild;
+    else if (nodes_[parent].left == oldChild)
+        nodes_[parent].left = newChild;
+    else
+        nodes_[parent].right = newChild;
+}
+
+template<typename T>
+void CompactTree<T>::rotateLeft(index_type x) {
+    index_type y = nodes_[x].right;
+    nodes_[x].right = nodes_[y].left;
+    if (nodes_[y].left != nil)
+        nodes_[nodes_[y].left].parent = x;
+    nodes_[y].parent = nodes_[x].parent;
+    replaceChild(nodes_[x].parent, x, y);
+    nodes_[y].left = x;
+    nodes_[x].parent = y;
+    updateHeight(x);
+    updateHeight(y);
+}
+
+template<typename T>
+void CompactTree<T>::rotateRight(index_type x) {
+    index_type y = nodes_[x].left;
+    nodes_[x].left = nodes_[y].right;
+    if (nodes_[y].right != nil)
+        nodes_[nodes_[y].right].parent = x;
+    nodes_[y].parent = nodes_[x].parent;
+    replaceChild(nodes_[x].parent, x, y);
+    nodes_[y].right = x;
+    nodes_[x].parent = y;
+    updateHeight(x);
+    updateHeight(y);
+}
+
+template<typename T>
+typename CompactTree<T>::index_type CompactTree<T>::rebalance(index_type i) {
+    const Node& n = nodes_[i];
+    std::int32_t balance = heightOf(n.left) - heightOf(n.right);
+    if (balance > 1) {
+        const Node& l = nodes_[n.left];
+        if (heightOf(l.left) < heightOf(l.right))
+            rotateLeft(n.left);
+        rotateRight(i);
+        return nodes_[i].parent;
+    }
+    if (balance < -1) {
+        const Node& r = nodes_[n.right];
+        if (heightOf(r.right) < heightOf(r.left))
+            rotateRight(n.right);
+        rotateLeft(i);
+        return nodes_[i].parent;
+    }
+    return i;
+}
+
+template<typename T>
+void CompactTree<T>::insert(const T& value) {
+    index_type parent = nil;
+    bool goLeft = false;
+    for (index_type i = root_; i != nil;) {
+        parent = i;
+        if (value < nodes_[i].data) {
+            i = nodes_[i].left;
+            goLeft = true;
+        } else if (nodes_[i].data < value) {
+            i = nodes_[i].right;
+            goLeft = false;
+        } else {
+            return;
+        }
+    }
+    if (nodes_.size() >= nil)
+        throw std::length_error("CompactTree is full");
+    index_type node = static_cast<index_type>(nodes_.size());
+    nodes_.push_back(Node{value, nil, nil, parent, 1});
+    if (parent == nil)
+        root_ = node;
+    else if (goLeft)
+        nodes_[parent].left = node;
+    else
+        nodes_[parent].right = node;
+
+    // Retrace until a subtree's height is unchanged.
+    for (index_type i = parent; i != nil; i = nodes_[i].parent) {
+        std::int32_t oldHeight = nodes_[i].height;
+        updateHeight(i);
+        i = rebalance(i);
+        if (nodes_[i].height == oldHeight)
+            break;
+    }
+}
+
+template<typename T>
+bool CompactTree<T>::remove(const T& value) {
+    index_type z = findIndex(value);
+    if (z == nil)
+        return false;
+    // With two children, move the successor's value up and unlink the successor.
+    if (nodes_[z].left != nil && nodes_[z].right != nil) {
+        index_type succ = findMin(nodes_[z].right);
+        nodes_[z].data = std::move(nodes_[succ].data);
+        z = succ;
+    }
+    index_type child = nodes_[z].left != nil ? nodes_[z].left : nodes_[z].right;
+    index_type parent = nodes_[z].parent;
+    replaceChild(parent, z, child);
+    if (child != nil)
+        nodes_[child].parent = parent;
+    for (index_type i = parent; i != nil; i = nodes_[i].parent) {
+        updateHeight(i);
+        i = rebalance(i);
+    }
+    fillHole(z);
+    return true;
+}
+
+template<typename T>
+void CompactTree<T>::fillHole(index_type hole) {
+    index_type last = static_cast<index_type>(nodes_.size() - 1);
+    if (hole != last) {
+        nodes_[hole] = std::move(nodes_[last]);
+        Node& moved = nodes_[hole];
+        replaceChild(moved.parent, last, hole);
+        if (moved.left != nil)
+            nodes_[moved.left].parent = hole;
+        if (moved.right != nil)
+            nodes_[moved.right].parent = hole;
+    }
+    nodes_.pop_back();
+}
+
+} // namespace dsa
+
+#endif // DSA_COMPACTTREE_HPP
@@ -0,0 +1,240 @@
+/**
+ * @file ConcurrentHashMap.hpp
+ * @brief Declares a thread-safe hash map sharded into independently locked segments.
+ *
+ * ConcurrentHashMap splits its entries over a power-of-two number of
+ * shards, each a HashMap guarded by its own reader/writer lock and padded
+ * to whole cache lines, so threads working on different shards share
+ * neither a lock nor a cache line. The shard of a key comes from the top
+ * bits of its mixed hash, while the shard's own table indexes by the low
+ * bits, so every shard uses all of its buckets.
+ *
+ * Lookups take the shard's lock in shared mode and run in parallel with
+ * each other; writers take it exclusively. upsert() and compute() read and
+ * modify an entry under one exclusive lock, so read-modify-write updates
+ * need no outer mutex.
+ *
+ * @section Complexity
+ * - get/contains/put/upsert/compute/remove: O(1) expected plus one lock
+ * - size: O(shards)
+ *
+ * @section Example
+ * @code
+ * dsa::ConcurrentHashMap<std::string, int> hits;
+ * // from any thread
+ * hits.upsert(path, 1, [](int& n) { ++n; });
+ * int n;
+ * if (hits.get("/index.html", n)) { ... }
+ * @endcode
+ */
+
+#ifndef DSA_CONCURRENTHASHMAP_HPP
+#define DSA_CONCURRENTHASHMAP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+#include "HashMap.hpp"
+#include "Utilities.hpp"
+
+namespace dsa {
+
+/**
+ * @class ConcurrentHashMap
+ * @brief A hash map with per-shard reader/writer locks.
+ *
+ * Values are copied out rather than returned by pointer, since a pointer
+ * would outlive the lock that protects it.
+ *
+ * @tparam Key Type of keys.
+ * @tparam Value Type of values.
+ * @tparam Layout Storage layout of each shard's HashMap.
+ * @tparam Hash Hash function; lookups are heterogeneous if it declares is_transparent.
+ *
+ * @section Thread Safety
+ * All member functions may be called concurrently from any thread.
+ */
+template<typename Key, typename Value, typename Layout = SeparateChaining, typename Hash = DefaultHash<Key>>
+class ConcurrentHashMap {
+    /// Enables a lookup by K when Hash is transparent.
+    template<typename K>
+    using Transparent = typename std::enable_if<detail::IsTransparentHash<Hash, K>::value, int>::type;
+
+public:
+    /**
+     * @brief Constructs an empty map.
+     * @param shards Number of shards, rounded up to a power of two and capped at 65536.
+     */
+    explicit ConcurrentHashMap(std::size_t shards = 64);
+
+    ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+    ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+
+    /// Inserts or updates a key-value pair.
+    void put(const Key& key, const Value& value) {
+        Shard& shard = shardOf(key);
+        std::unique_lock<std::shared_mutex> lock(shard.lock);
+        shard.map.put(key, value);
+    }
+
+    /// Alias for put method.
+    void insert(const Key& key, const Value& value) { put(key, value); }
+
+    /**
+     * @brief Copies the value of @p key into @p value.
+     * @return True if the key was found.
+     */
+    bool get(const Key& key, Value& value) const { return getImpl(key, value); }
+    /// Heterogeneous get(); available when Hash is transparent.
+    template<typename K, Transparent<K> = 0>
+    bool get(const K& key, Value& value) const { return getImpl(key, value); }
+
+    /// Checks whether @p key is present.
+    bool contains(const Key& key) const { return containsImpl(key); }
+    /// Heterogeneous contains(); available when Hash is transparent.
+    template<typename K, Transparent<K> = 0>
+    bool contains(const K& key) const { return containsImpl(key); }
+
+    /**
+     * @brief Inserts @p value if @p key is absent, otherwise calls @p update on the stored value.
+     *
+     * Both happen under the shard's exclusive lock, so concurrent upserts of
+     * one key never lose an update. @p update must not call back into the map.
+     *
+     * @return True if the key was inserted.
+     */
+    template<typename F>
+    bool upsert(const Key& key, const Value& value, F&& update);
+
+    /**
+     * @brief Atomically reads, changes or removes the entry of @p key.
+     *
+     * Calls @p fn(Value& value, bool present) under the shard's exclusive
+     * lock; an absent key is first given a value-initialized value. The entry
+     * is kept (or inserted) if @p fn returns true and removed otherwise.
+     * @p fn must not call back into the map.
+     *
+     * @return Whether the key is present afterwards.
+     */
+    template<typename F>
+    bool compute(const Key& key, F&& fn);
+
+    /**
+     * @brief Removes @p key.
+     * @return True if it was present.
+     */
+    bool remove(const Key& key);
+
+    /// Returns the number of entries; only a snapshot while writers are active.
+    std::size_t size() const;
+
+    /// Checks if the map is empty.
+    bool empty() const { return size() == 0; }
+
+    /// Returns the number of shards.
+    std::size_t shard_count() const { return shardMask_ + 1; }
+
+private:
+    using Map = HashMap<Key, Value, Layout, Hash>;
+
+    /// One segment; aligned so neighbouring locks never share a cache line.
+    struct alignas(cacheLineSize) Shard {
+        mutable std::shared_mutex lock; ///< Shared for lookups, exclusive for writes.
+        Map map;                        ///< Entries whose hash selects this shard.
+    };
+
+    std::unique_ptr<Shard[]> shards_; ///< shardMask_ + 1 shards.
+    std::size_t shardMask_;           ///< Number of shards minus one.
+
+    /// Returns the shard of @p key, chosen by the top 16 bits of its mixed hash.
+    template<typename K>
+    Shard& shardOf(const K& key) const {
+        std::uint64_t h = detail::mixHash(Hash{}(key));
+        return shards_[static_cast<std::size_t>(h >> 48) & shardMask_];
+    }
+
+    template<typename K>
+    bool getImpl(const K& key, Value& value) const {
+        const Shard& shard = shardOf(key);
+        std::shared_lock<std::shared_mutex> lock(shard.lock);
+        return shard.map.get(key, value);
+    }
+
+    template<typename K>
+    bool containsImpl(const K& key) const {
+        const Shard& shard = shardOf(key);
+        std::shared_lock<std::shared_mutex> lock(shard.lock);
+        return shard.map.contains(key);
+    }
+};
+
+template<typename Key, typename Value, typename Layout, typename Hash>
+ConcurrentHashMap<Key, Value, Layout, Hash>::ConcurrentHashMap(std::size_t shards) {
+    std::size_t count = 1;
+    while (count < shards && count < (std::size_t(1) << 16))
+        count *= 2;
+    shards_.reset(new Shard[count]);
+    shardMask_ = count - 1;
+}
+
+template<typename Key, typename Value, typename Layout, typename Hash>
+template<typename F>
+bool ConcurrentHashMap<Key, Value, Layout, Hash>::upsert(const Key& key, const Value& value, F&& update) {
+    Shard& shard = shardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    if (Value* current = shard.map.find(key)) {
+        update(*current);
+        return false;
+    }
+    shard.map.put(key, value);
+    return true;
+}
+
+template<typename Key, typename Value, typename Layout, typename Hash>
+template<typename F>
+bool ConcurrentHashMap<Key, Value, Layout, Hash>::compute(const Key& key, F&& fn) {
+    Shard& shard = shardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    Value* current = shard.map.find(key);
+    const bool present = current != nullptr;
+    if (!present)
+        current = &shard.map[key];
+    bool keep;
+    try {
+        keep = fn(*current, present);
+    } catch (...) {
+        if (!present)
+            shard.map.remove(key);
+        throw;
+    }
+    if (!keep)
+        shard.map.remove(key);
+    return keep;
+}
+
+template<typename Key, typename Value, typename Layout, typename Hash>
+bool ConcurrentHashMap<Key, Value, Layout, Hash>::remove(const Key& key) {
+    Shard& shard = shardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.lock);
+    std::size_t before = shard.map.size();
+    shard.map.remove(key);
+    return shard.map.size() != before;
+}
+
+template<typename Key, typename Value, typename Layout, typename Hash>
+std::size_t ConcurrentHashMap<Key, Value, Layout, Hash>::size() const {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i <= shardMask_; ++i) {
+        std::shared_lock<std::shared_mutex> lock(shards_[i].lock);
+        total += shards_[i].map.size();
+    }
+    return total;
+}
+
+} // namespace dsa
+
+#endif // DSA_CONCURRENTHASHMAP_HPP
@@ -0,0 +1,441 @@
+/**
+ * @file FrozenHashMap.hpp
+ * @brief Defines an immutable hash map indexed by a minimal perfect hash.
+ *
+ * The keys are known when the map is built, so instead of buckets and
+ * collision chains it computes a minimal perfect hash in the style of
+ * PTHash: every key lands in one of n/5 buckets, and each bucket stores a
+ * 16-bit pilot chosen so that its keys, mixed with the pilot, hit slots
+ * that no other key uses. The n entries then sit in one array in slot
+ * order. Slots are drawn from a table 1% larger than n to make the last
+ * pilots easy to find; the keys that land past n are sent to the free
+ * slots below it through a small remap array.
+ *
+ * A lookup hashes the key, reads its bucket's pilot and compares the key
+ * stored in the one slot it can occupy. Beyond the entries themselves the
+ * map needs about 3.5 bits per key. save() and load() write and read the
+ * whole layout, so a table can be built once and mapped in at startup.
+ *
+ * @section Complexity
+ * - Construction: O(n) expected
+ * - find/contains/get: O(1) worst case, a single probe
+ *
+ * @section Example
+ * @code
+ * dsa::HashMap<std::string, int> codes;
+ * codes.put("GET", 1);
+ * codes.put("PUT", 2);
+ * dsa::FrozenHashMap<std::string, int> frozen(codes);
+ * if (const int* code = frozen.find("GET")) { ... }
+ * @endcode
+ */
+
+#ifndef DSA_FROZENHASHMAP_HPP
+#define DSA_FROZENHASHMAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "HashMap.hpp"
+
+namespace dsa {
+
+namespace detail {
+
+/// Most bytes load() reads into one new allocation; a corrupt length then
+/// runs into the end of the stream before it can exhaust memory.
+constexpr std::size_t frozenChunk = std::size_t(1) << 16;
+
+/// Reads and writes trivially copyable values as their bytes.
+template<typename T, typename = void>
+struct FrozenIO {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "FrozenHashMap can only save trivially copyable types and std::string");
+
+    static void write(std::ostream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    static void read(std::istream& in, T& value) {
+        in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    }
+};
+
+/// Writes a std::string as its 64-bit length followed by its characters.
+template<>
+struct FrozenIO<std::string> {
+    static void write(std::ostream& out, const std::string& value) {
+        FrozenIO<std::uint64_t>::write(out, value.size());
+        out.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+    static void read(std::istream& in, std::string& value) {
+        std::uint64_t length = 0;
+        FrozenIO<std::uint64_t>::read(in, length);
+        value.clear();
+        while (length > 0 && in) {
+            std::size_t step = static_cast<std::size_t>(std::min<std::uint64_t>(length, frozenChunk));
+            std::size_t old = value.size();
+            value.resize(old + step);
+            in.read(&value[old], static_cast<std::streamsize>(step));
+            length -= step;
+        }
+    }
+};
+
+/// Reads @p count trivially copyable values into @p out, growing it one chunk at a time.
+template<typename T>
+void readFrozenArray(std::istream& in, std::vector<T>& out, std::uint64_t count) {
+    out.clear();
+    while (out.size() < count && in) {
+        std::size_t step = static_cast<std::size_t>(
+            std::min<std::uint64_t>(count - out.size(), frozenChunk / sizeof(T)));
+        std::size_t old = out.size();
+        out.resize(old + step);
+        in.read(reinterpret_cast<char*>(out.data() + old), static_cast<std::streamsize>(step * sizeof(T)));
+    }
+}
+
+/// Maps a uniform 64-bit @p x to [0, range) without a division.
+inline std::uint64_t fastRange(std::uint64_t x, std::uint64_t range) {
+#if defined(__SIZEOF_INT128__)
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(x) * range) >> 64);
+#else
+    return x % range;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @class FrozenHashMap
+ * @brief A read-only hash map with exactly one probe per lookup.
+ *
+ * @tparam Key Type of keys. Must be copyable and comparable with ==.
+ * @tparam Value Type of values. Must be copyable.
+ * @tparam Hash Hash function; lookups are heterogeneous if it declares is_transparent.
+ */
+template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+class FrozenHashMap {
+    /// Enables a lookup by K when Hash is transparent.
+    template<typename K>
+    using Transparent = typename std::enable_if<detail::IsTransparentHash<Hash, K>::value, int>::type;
+
+public:
+    /// Constructs an empty map.
+    FrozenHashMap() : size_(0), tableSize_(0), seed_(0) {}
+
+    /**
+     * @brief Builds the map from a range of key-value pairs.
+     * @tparam InputIt Iterator over pairs whose first is the key.
+     * @throws std::invalid_argument if a key occurs twice, or two keys have equal hashes.
+     */
+    template<typename InputIt>
+    FrozenHashMap(InputIt first, InputIt last) : FrozenHashMap() {
+        build(std::vector<std::pair<Key, Value>>(first, last));
+    }
+
+    /// Freezes the current contents of a HashMap.
+    template<typename Layout, typename OtherHash>
+    explicit FrozenHashMap(const HashMap<Key, Value, Layout, OtherHash>& map) : FrozenHashMap() {
+        std::vector<std::pair<Key, Value>> entries;
+        entries.reserve(map.size());
+        map.for_each([&entries](const Key& key, const Value& value) { entries.emplace_back(key, value); });
+        build(std::move(entries));
+    }
+
+    /// Returns a pointer to the value of @p key, or nullptr if absent.
+    const Value* find(const Key& key) const { return findImpl(key); }
+    /// Heterogeneous find(); available when Hash is transparent.
+    template<typename K, Transparent<K> = 0>
+    const Value* find(const K& key) const { return findImpl(key); }
+
+    /// Checks whether @p key is present.
+    bool contains(const Key& key) const { return findImpl(key) != nullptr; }
+    /// Heterogeneous contains(); available when Hash is transparent.
+    template<typename K, Transparent<K> = 0>
+    bool contains(const K& key) const { return findImpl(key) != nullptr; }
+
+    /**
+     * @brief Copies the value of @p key into @p value.
+     * @return True if the key was found.
+     */
+    bool get(const Key& key, Value& value) const {
+        const Value* found = findImpl(key);
+        if (!found)
+            return false;
+        value = *found;
+        return true;
+    }
+
+    /// Returns the number of entries.
+    std::size_t size() const { return size_; }
+    /// Checks if the map is empty.
+    bool empty() const { return size_ == 0; }
+
+    /// Bits per key spent on the perfect hash (pilots and remap), beyond the entries.
+    double bits_per_key() const {
+        return size_ ? (pilots_.size() * 16.0 + remap_.size() * 32.0) / size_ : 0.0;
+    }
+
+    /**
+     * @brief Writes the map to @p out in host byte order.
+     *
+     * Keys and values must be trivially copyable or std::string.
+     */
+    void save(std::ostream& out) const;
+
+    /**
+     * @brief Reads a map written by save() with the same Key, Value and Hash.
+     * @throws std::runtime_error if the stream is not such a map, is corrupt or ends early.
+     */
+    static FrozenHashMap load(std::istream& in);
+
+private:
+    /// Average number of keys per bucket; about 16 / keysPerBucket bits of pilots per key.
+    static constexpr std::size_t keysPerBucket = 5;
+    /// Most entries a map can hold; remap_ stores slots as 32-bit values.
+    static constexpr std::uint64_t maxEntries = 0xFFFFFFFFu;
+    /// Seeds tried before giving up; each fails only if some bucket exhausts all pilots.
+    static constexpr std::uint64_t maxAttempts = 64;
+    /// Written first by save().
+    static constexpr char magic[8] = {'D', 'S', 'A', 'F', 'H', 'M', '1', '\0'};
+
+    std::vector<std::uint16_t> pilots_;             ///< Pilot of each bucket.
+    std::vector<std::uint32_t> remap_;              ///< Slot below size_ for each slot from size_ up.
+    std::vector<std::pair<Key, Value>> entries_;    ///< Entries in slot order.
+    std::size_t size_;                              ///< Number of entries.
+    std::size_t tableSize_;                         ///< Slots keys are first placed in; >= size_.
+    std::uint64_t seed_;                            ///< Seed that let every bucket find a pilot.
+
+    /// Number of buckets for @p n keys.
+    static std::size_t bucketsFor(std::size_t n) { return (n + keysPerBucket - 1) / keysPerBucket; }
+    /// Number of slots keys are first placed in: 1% more than @p n.
+    static std::size_t tableSizeFor(std::size_t n) { return n + (n + 98) / 99; }
+
+    /// Hash of @p key under the current seed.
+    template<typename K>
+    std::uint64_t keyHash(const K& key) const {
+        return detail::mixHash(static_cast<std::uint64_t>(Hash{}(key)) ^ seed_);
+    }
+
+    /**
+     * Bucket of key hash @p x. As in PTHash, 60% of the keys go to the first
+     * 30% of the buckets, so the large buckets are placed while the table is
+     * still empty.
+     */
+    std::size_t bucketOf(std::uint64_t x) const {
+        const std::uint64_t buckets = pilots_.size();
+        const std::uint64_t dense = (buckets * 3 + 9) / 10;
+        if ((x & 0xFFFFFFFFu) < 0x99999999u || dense == buckets)
+            return static_cast<std::size_t>(detail::fastRange(x, dense));
+        return static_cast<std::size_t>(dense + detail::fastRange(x, buckets - dense));
+    }
+
+    /// Table position of key hash @p x under @p pilot.
+    std::size_t position(std::uint64_t x, std::uint16_t pilot) const {
+        return static_cast<std::size_t>(
+            detail::fastRange(detail::mixHash(x ^ (pilot * 0xD6E8FEB86659FD93ull)), tableSize_));
+    }
+
+    template<typename K>
+    const Value* findImpl(const K& key) const {
+        if (size_ == 0)
+            return nullptr;
+        const std::uint64_t x = keyHash(key);
+        std::size_t slot = position(x, pilots_[bucketOf(x)]);
+        if (slot >= size_)
+            slot = remap_[slot - size_];
+        const auto& entry = entries_[slot];
+        return entry.first == key ? &entry.second : nullptr;
+    }
+
+    /// Computes the perfect hash of @p entries and stores them in slot order.
+    void build(std::vector<std::pair<Key, Value>> entries);
+
+    /**
+     * Tries to find a pilot for every bucket under seed_; fills pilots_ and
+     * @p slots (table position of each entry) on success.
+     */
+    bool placeAll(const std::vector<std::uint64_t>& hashes, std::vector<std::size_t>& slots);
+};
+
+template<typename Key, typename Value, typename Hash>
+constexpr char FrozenHashMap<Key, Value, Hash>::magic[8];
+
+template<typename Key, typename Value, typename Hash>
+void FrozenHashMap<Key, Value, Hash>::build(std::vector<std::pair<Key, Value>> entries) {
+    const std::size_t n = entries.size();
+    if (n == 0)
+        return;
+    if (n > maxEntries)
+        throw std::length_error("FrozenHashMap holds at most 2^32 - 1 entries");
+    size_ = n;
+    tableSize_ = tableSizeFor(n);
+    pilots_.assign(bucketsFor(n), 0);
+
+    std::vector<std::uint64_t> hashes(n);
+    std::vector<std::size_t> slots(n);
+    bool placed = false;
+    for (std::uint64_t attempt = 0; attempt < maxAttempts && !placed; ++attempt) {
+        seed_ = detail::mixHash(attempt + 1);
+        for (std::size_t i = 0; i < n; ++i)
+            hashes[i] = keyHash(entries[i].first);
+        placed = placeAll(hashes, slots);
+    }
+    if (!placed)
+        throw std::runtime_error("FrozenHashMap could not find a perfect hash");
+
+    // Send the keys placed past n to the free slots below it, in order.
+    std::vector<std::size_t> owner(tableSize_, n);
+    for (std::size_t i = 0; i < n; ++i)
+        owner[slots[i]] = i;
+    remap_.assign(tableSize_ - n, 0);
+    std::size_t free = 0;
+    for (std::size_t pos = n; pos < tableSize_; ++pos) {
+        if (owner[pos] == n)
+            continue;
+        while (owner[free] != n)
+            ++free;
+        remap_[pos - n] = static_cast<std::uint32_t>(free);
+        owner[free] = owner[pos];
+        ++free;
+    }
+    entries_.reserve(n);
+    for (std::size_t slot = 0; slot < n; ++slot)
+        entries_.push_back(std::move(entries[owner[slot]]));
+}
+
+template<typename Key, typename Value, typename Hash>
+bool FrozenHashMap<Key, Value, Hash>::placeAll(const std::vector<std::uint64_t>& hashes,
+                                               std::vector<std::size_t>& slots) {
+    const std::size_t n = hashes.size();
+    const std::size_t buckets = pilots_.size();
+
+    // Counting sort of the keys by bucket, then of the buckets by size.
+    std::vector<std::size_t> start(buckets + 1, 0);
+    for (std::size_t i = 0; i < n; ++i)
+        ++start[bucketOf(hashes[i]) + 1];
+    std::size_t largest = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        largest = std::max(largest, start[b + 1]);
+        start[b + 1] += start[b];
+    }
+    std::vector<std::size_t> members(n);
+    {
+        std::vector<std::size_t> next(start.begin(), start.end() - 1);
+        for (std::size_t i = 0; i < n; ++i)
+            members[next[bucketOf(hashes[i])]++] = i;
+    }
+    std::vector<std::size_t> bySize(largest + 2, 0);
+    for (std::size_t b = 0; b < buckets; ++b)
+        ++bySize[largest - (start[b + 1] - start[b]) + 1];
+    for (std::size_t k = 1; k < bySize.size(); ++k)
+        bySize[k] += bySize[k - 1];
+    std::vector<std::size_t> order(buckets);
+    for (std::size_t b = 0; b < buckets; ++b)
+        order[bySize[largest - (start[b + 1] - start[b])]++] = b;
+
+    std::vector<bool> taken(tableSize_, false);
+    std::vector<std::size_t> trial;
+    for (std::size_t b : order) {
+        const std::size_t first = start[b];
+        const std::size_t count = start[b + 1] - first;
+        if (count == 0)
+            break;
+        // Keys with equal hashes can never be separated by a pilot.
+        std::sort(members.begin() + first, members.begin() + first + count,
+                  [&hashes](std::size_t a, std::size_t c) { return hashes[a] < hashes[c]; });
+        for (std::size_t k = 1; k < count; ++k)
+            if (hashes[members[first + k]] == hashes[members[first + k - 1]])
+                throw std::invalid_argument("FrozenHashMap keys must be distinct and hash differently");
+        bool found = false;
+        for (std::uint32_t pilot = 0; pilot <= 0xFFFFu && !found; ++pilot) {
+            trial.clear();
+            for (std::size_t k = 0; k < count; ++k) {
+                std::size_t pos = position(hashes[members[first + k]], static_cast<std::uint16_t>(pilot));
+                if (taken[pos] || std::find(trial.begin(), trial.end(), pos) != trial.end())
+                    break;
+                trial.push_back(pos);
+            }
+            if (trial.size() == count) {
+                found = true;
+                pilots_[b] = static_cast<std::uint16_t>(pilot);
+                for (std::size_t k = 0; k < count; ++k) {
+                    taken[trial[k]] = true;
+                    slots[members[first + k]] = trial[k];
+                }
+            }
+        }
+        if (!found)
+            return false;
+    }
+    return true;
+}
+
+template<typename Key, typename Value, typename Hash>
+void FrozenHashMap<Key, Value, Hash>::save(std::ostream& out) const {
+    out.write(magic, sizeof(magic));
+    detail::FrozenIO<std::uint64_t>::write(out, size_);
+    detail::FrozenIO<std::uint64_t>::write(out, tableSize_);
+    detail::FrozenIO<std::uint64_t>::write(out, pilots_.size());
+    detail::FrozenIO<std::uint64_t>::write(out, seed_);
+    out.write(reinterpret_cast<const char*>(pilots_.data()),
+              static_cast<std::streamsize>(pilots_.size() * sizeof(std::uint16_t)));
+    out.write(reinterpret_cast<const char*>(remap_.data()),
+              static_cast<std::streamsize>(remap_.size() * sizeof(std::uint32_t)));
+    for (const auto& entry : entries_) {
+        detail::FrozenIO<Key>::write(out, entry.first);
+        detail::FrozenIO<Value>::write(out, entry.second);
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+FrozenHashMap<Key, Value, Hash> FrozenHashMap<Key, Value, Hash>::load(std::istream& in) {
+    char header[sizeof(magic)];
+    in.read(header, sizeof(header));
+    if (!in || !std::equal(header, header + sizeof(header), magic))
+        throw std::runtime_error("not a saved FrozenHashMap");
+    std::uint64_t size = 0, tableSize = 0, buckets = 0, seed = 0;
+    detail::FrozenIO<std::uint64_t>::read(in, size);
+    detail::FrozenIO<std::uint64_t>::read(in, tableSize);
+    detail::FrozenIO<std::uint64_t>::read(in, buckets);
+    detail::FrozenIO<std::uint64_t>::read(in, seed);
+    // Every field is checked before anything is allocated for it.
+    if (!in)
+        throw std::runtime_error("truncated FrozenHashMap");
+    if (size > maxEntries || tableSize != tableSizeFor(static_cast<std::size_t>(size))
+        || buckets != bucketsFor(static_cast<std::size_t>(size)))
+        throw std::runtime_error("corrupt FrozenHashMap header");
+
+    FrozenHashMap map;
+    map.size_ = static_cast<std::size_t>(size);
+    map.tableSize_ = static_cast<std::size_t>(tableSize);
+    map.seed_ = seed;
+    detail::readFrozenArray(in, map.pilots_, buckets);
+    detail::readFrozenArray(in, map.remap_, tableSize - size);
+    map.entries_.reserve(std::min<std::size_t>(map.size_, detail::frozenChunk));
+    for (std::size_t i = 0; i < map.size_ && in; ++i) {
+        Key key{};
+        Value value{};
+        detail::FrozenIO<Key>::read(in, key);
+        detail::FrozenIO<Value>::read(in, value);
+        map.entries_.emplace_back(std::move(key), std::move(value));
+    }
+    if (!in)
+        throw std::runtime_error("truncated FrozenHashMap");
+    for (std::uint32_t slot : map.remap_)
+        if (slot >= map.size_)
+            throw std::runtime_error("corrupt FrozenHashMap remap");
+    return map;
+}
+
+} // namespace dsa
+
+#endif // DSA_FROZENHASHMAP_HPP
@@ -0,0 +1,218 @@
+/**
+ * @file FrozenSearchTree.hpp
+ * @brief Defines an immutable search tree stored in Eytzinger (BFS) order.
+ *
+ * The elements of a sorted range are laid out in one cache-line aligned
+ * array in breadth-first order of the implicit perfectly balanced tree:
+ * the children of slot k are slots 2k and 2k + 1. A lookup walks down that
+ * implicit tree with no data-dependent branches and prefetches the cache
+ * line holding its descendants four levels below, so the first levels stay
+ * hot in cache and later ones are already on their way.
+ *
+ * @section Complexity
+ * - Construction: O(n)
+ * - contains/lower_bound: O(log n), branchless
+ *
+ * @section Example
+ * @code
+ * std::vector<int> keys = {1, 3, 5, 7};
+ * dsa::FrozenSearchTree<int> table(keys.begin(), keys.end());
+ * bool hit = table.contains(5);
+ * const int* next = table.lower_bound(4); // points to 5
+ * @endcode
+ */
+
+#ifndef DSA_FROZENSEARCHTREE_HPP
+#define DSA_FROZENSEARCHTREE_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include "Tree.hpp"
+#include "Utilities.hpp"
+
+namespace dsa {
+
+/**
+ * @class FrozenSearchTree
+ * @brief A read-only sorted set optimized for very frequent lookups.
+ *
+ * Equivalent elements in the input are all kept. Elements are compared with
+ * operator< only.
+ *
+ * @tparam T Type of elements. Must be default constructible and copyable.
+ */
+template<typename T>
+class FrozenSearchTree {
+public:
+    /// Constructs an empty tree.
+    FrozenSearchTree() : data_(nullptr), size_(0) {}
+
+    /**
+     * @brief Builds the tree from a sorted range.
+     * @tparam ForwardIt Forward iterator; the range is traversed twice.
+     * @param first Beginning of a range sorted by operator<.
+     * @param last End of the range.
+     */
+    template<typename ForwardIt>
+    FrozenSearchTree(ForwardIt first, ForwardIt last);
+
+    /// Freezes the current contents of a BinarySearchTree.
+    template<typename Balance>
+    explicit FrozenSearchTree(const BinarySearchTree<T, Balance>& tree)
+        : FrozenSearchTree(tree.begin(), tree.end()) {}
+
+    /// Copy constructor.
+    FrozenSearchTree(const FrozenSearchTree& other);
+    /// Move constructor.
+    FrozenSearchTree(FrozenSearchTree&& other) noexcept : data_(other.data_), size_(other.size_) {
+        other.data_ = nullptr;
+        other.size_ = 0;
+    }
+    /**
+     * @brief Copy assignment operator.
+     * @param other Another tree.
+     * @return Reference to this tree.
+     */
+    FrozenSearchTree& operator=(FrozenSearchTree other) {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+    /// Destructor.
+    ~FrozenSearchTree() { release(data_, size_); }
+
+    /**
+     * @brief Finds the smallest element not less than @p value.
+     * @return Pointer to that element, or nullptr if every element is less.
+     */
+    const T* lower_bound(const T& value) const {
+        std::size_t k = search(value);
+        return k ? &data_[k] : nullptr;
+    }
+
+    /// Checks whether an element equivalent to @p value is present.
+    bool contains(const T& value) const {
+        std::size_t k = search(value);
+        return k && !(value < data_[k]);
+    }
+
+    /// Returns the number of elements.
+    std::size_t size() const { return size_; }
+    /// Checks if the tree is empty.
+    bool empty() const { return size_ == 0; }
+
+private:
+    /// Elements per cache line; a lookup prefetches this many levels' worth ahead.
+    static constexpr std::size_t lineElements =
+        sizeof(T) < cacheLineSize ? cacheLineSize / sizeof(T) : 1;
+
+    T* data_;          ///< Slots 1..size_ in Eytzinger order; slot 0 is unused.
+    std::size_t size_; ///< Number of elements.
+
+    /// Returns the Eytzinger index of the lower bound of value, or 0.
+    std::size_t search(const T& value) const;
+
+    /// Allocates and default-constructs n + 1 aligned slots.
+    static T* allocate(std::size_t n);
+    /// Destroys and frees slots obtained from allocate(n).
+    static void release(T* data, std::size_t n);
+
+    /// Writes the next elements of @p it to the subtree rooted at slot k, in order.
+    template<typename ForwardIt>
+    void fill(ForwardIt& it, std::size_t k);
+};
+
+template<typename T>
+T* FrozenSearchTree<T>::allocate(std::size_t n) {
+    void* raw = ::operator new((n + 1) * sizeof(T), std::align_val_t(cacheLineSize));
+    T* data = static_cast<T*>(raw);
+    std::size_t built = 0;
+    try {
+        for (; built <= n; ++built)
+            new (data + built) T();
+    } catch (...) {
+        while (built > 0)
+            data[--built].~T();
+        ::operator delete(raw, std::align_val_t(cacheLineSize));
+        throw;
+    }
+    return data;
+}
+
+template<typename T>
+void FrozenSearchTree<T>::release(T* data, std::size_t n) {
+    if (!data)
+        return;
+    for (std::size_t i = 0; i <= n; ++i)
+        data[i].~T();
+    ::operator delete(static_cast<void*>(data), std::align_val_t(cacheLineSize));
+}
+
+template<typename T>
+template<typename ForwardIt>
+void FrozenSearchTree<T>::fill(ForwardIt& it, std::size_t k) {
+    // Recursion depth is log2(n).
+    if (k > size_)
+        return;
+    fill(it, 2 * k);
+    data_[k] = *it;
+    ++it;
+    fill(it, 2 * k + 1);
+}
+
+template<typename T>
+template<typename ForwardIt>
+FrozenSearchTree<T>::FrozenSearchTree(ForwardIt first, ForwardIt last)
+    : data_(nullptr), size_(static_cast<std::size_t>(std::distance(first, last))) {
+    if (size_ == 0)
+        return;
+    data_ = allocate(size_);
+    try {
+        fill(first, 1);
+    } catch (...) {
+        release(data_, size_);
+        throw;
+    }
+}
+
+template<typename T>
+FrozenSearchTree<T>::FrozenSearchTree(const FrozenSearchTree& other) : data_(nullptr), size_(other.size_) {
+    if (size_ == 0)
+        return;
+    data_ = allocate(size_);
+    try {
+        for (std::size_t i = 1; i <= size_; ++i)
+            data_[i] = other.data_[i];
+    } catch (...) {
+        release(data_, size_);
+        throw;
+    }
+}
+
+template<typename T>
+std::size_t FrozenSearchTree<T>::search(const T& value) const {
+    std::size_t k = 1;
+    while (k <= size_) {
+#if defined(__GNUC__) || defined(__clang__)
+        // Descendants four levels down share one cache line when T is 4 bytes.
+        std::size_t ahead = k * lineElements;
+        __builtin_prefetch(data_ + (ahead <= size_ ? ahead : 0));
+#endif
+        k = 2 * k + (data_[k] < value);
+    }
+    // Undo the trailing right turns plus the final left turn that overshot.
+#if defined(__GNUC__) || defined(__clang__)
+    k >>= __builtin_ctzll(~static_cast<unsigned long long>(k)) + 1;
+#else
+    while (k & 1)
+        k >>= 1;
+    k >>= 1;
+#endif
+    return k;
+}
+
+} // namespace dsa
+
+#endif // DSA_FROZENSEARCHTREE_HPP
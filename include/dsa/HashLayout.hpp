@@ -0,0 +1,496 @@
+/**
+ * @file HashLayout.hpp
+ * @brief Declares the storage layouts used by HashMap.
+ *
+ * A layout is a tag type whose nested class template Table<Key, Value, Hash>
+ * stores the entries and implements tryEmplace(), find(), remove(), size()
+ * and forEach(); HashMap builds its interface on them. find() is a template, so
+ * a Hash that declares @c is_transparent (as DefaultHash<std::string>
+ * does) lets lookups take a std::string_view or const char* without
+ * building a Key. Besides SeparateChaining below, SwissTable.hpp
+ * and RobinHoodTable.hpp provide flat open addressing.
+ *
+ * @section Layouts
+ * - SeparateChaining: one std::list per bucket; stable nodes, more pointer chasing;
+ *   BasicSeparateChaining<Mix, Incremental> picks the hash finalizer and
+ *   whether rehashing is spread over later operations (IncrementalChaining)
+ * - SwissTable: flat slot array probed a SIMD group of control bytes at a time
+ * - RobinHood: flat slot array with distance-ordered runs; load factor up to 0.9
+ */
+
+#ifndef DSA_HASHLAYOUT_HPP
+#define DSA_HASHLAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dsa {
+
+namespace detail {
+
+/**
+ * @brief Spreads the entropy of a hash over all 64 bits.
+ *
+ * Standard library hashes of integers are often the identity, which would
+ * send sequential keys to neighbouring slots of an open-addressing table.
+ * Folds the 128-bit product with a large odd constant (as in wyhash).
+ */
+inline std::uint64_t mixHash(std::uint64_t h) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 product = static_cast<unsigned __int128>(h) * 0x9E3779B97F4A7C15ull;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    return h ^ (h >> 33);
+#endif
+}
+
+/// True if H declares is_transparent; K only makes the check SFINAE-dependent.
+template<typename H, typename K, typename = void>
+struct IsTransparentHash : std::false_type {};
+
+template<typename H, typename K>
+struct IsTransparentHash<H, K, std::void_t<typename H::is_transparent>> : std::true_type {};
+
+} // namespace detail
+
+/// Hash used by HashMap unless another is given: std::hash<Key>.
+template<typename Key>
+struct DefaultHash : std::hash<Key> {};
+
+/**
+ * @brief Transparent hash for std::string keys.
+ *
+ * Hashes through std::string_view, which the standard requires to agree
+ * with std::hash<std::string>, so string_view and C-string lookups find
+ * the same entries as std::string ones.
+ */
+template<>
+struct DefaultHash<std::string> {
+    using is_transparent = void;
+
+    std::size_t operator()(std::string_view key) const noexcept {
+        return std::hash<std::string_view>{}(key);
+    }
+};
+
+/// Finalizer folding a 128-bit product (wyhash); the default.
+struct WyMix {
+    std::uint64_t operator()(std::uint64_t h) const { return detail::mixHash(h); }
+};
+
+/// Finalizer using xxh3's avalanche step: xor-shift, multiply, xor-shift.
+struct Xxh3Mix {
+    std::uint64_t operator()(std::uint64_t h) const {
+        h ^= h >> 37;
+        h *= 0x165667919E3779F9ull;
+        return h ^ (h >> 32);
+    }
+};
+
+/// Uses the hash as is; only suitable for hashes whose low bits are already random.
+struct NoMix {
+    std::uint64_t operator()(std::uint64_t h) const { return h; }
+};
+
+/**
+ * @struct BasicSeparateChaining
+ * @brief Layout storing each bucket's entries in a std::list.
+ *
+ * The bucket count is a power of two and the bucket of a key is the low
+ * bits of Mix applied to its hash, so no division is needed, and keys that
+ * std::hash maps to themselves (integers) still spread over all buckets.
+ *
+ * Growing splices the existing list nodes into the new buckets, so entries
+ * never move in memory. With Incremental set, growing only allocates the
+ * doubled bucket array. Old bucket j then splits into new buckets j and
+ * j + old count, and every later insert or remove splits a few more. New
+ * buckets are constructed only when split into, so no single operation
+ * touches the whole table. Until then a key still belongs to its old
+ * bucket, so every operation visits exactly one bucket, and lookups never
+ * split anything themselves, which keeps const lookups free of writes.
+ *
+ * @tparam Mix Finalizer applied to Hash's result: WyMix, Xxh3Mix or NoMix.
+ * @tparam Incremental Spread each rehash over the following operations.
+ */
+template<typename Mix = WyMix, bool Incremental = false>
+struct BasicSeparateChaining {
+    /**
+     * @class Table
+     * @brief Chained hash table; rehashes into twice the buckets when full.
+     *
+     * Values never move, so pointers returned by find() stay valid until
+     * their entry is removed.
+     */
+    template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+    class Table {
+    public:
+        /// Constructs a table with @p buckets buckets, rounded up to a power of two.
+        explicit Table(std::size_t buckets);
+        /// Copy constructor.
+        Table(const Table& other);
+        /// Move constructor; leaves @p other empty with one bucket.
+        Table(Table&& other);
+        /// Copy and move assignment.
+        Table& operator=(Table other) noexcept;
+        /// Destructor.
+        ~Table();
+
+        /**
+         * Inserts @p key with a value built from @p args unless it is present.
+         * Returns the key's value and whether it was inserted.
+         */
+        template<typename... Args>
+        std::pair<Value*, bool> tryEmplace(const Key& key, Args&&... args);
+        /// Returns the value of @p key, or nullptr if absent.
+        template<typename K>
+        Value* find(const K& key);
+        /// Removes @p key if present.
+        void remove(const Key& key);
+        /// Returns the number of entries.
+        std::size_t size() const { return size_; }
+        /// Returns the number of buckets.
+        std::size_t bucketCount() const { return buckets_; }
+        /// Calls @p fn(key, value) for every entry, in no particular order.
+        template<typename F>
+        void forEach(F& fn) const;
+
+        /// Grows the table so that @p count entries fit without a rehash.
+        void reserve(std::size_t count);
+        /// Returns the load factor above which the table grows.
+        float maxLoadFactor() const { return maxLoadFactor_; }
+        /**
+         * Sets the load factor above which the table grows; rehashes at once
+         * if already above it.
+         * @throws std::invalid_argument unless @p factor > 0.
+         */
+        void maxLoadFactor(float factor);
+
+    private:
+        using Bucket = std::list<std::pair<Key, Value>>;
+
+        /// Old buckets split by each insert or remove while a rehash is in progress.
+        static constexpr std::size_t splitStep = 4;
+
+        /**
+         * buckets_ buckets. While old_ is set, only buckets j and j + oldBuckets_
+         * for j < split_ are constructed; otherwise all of them are.
+         */
+        Bucket* table_;
+        std::size_t buckets_;     ///< Number of buckets; a power of two.
+        Bucket* old_;             ///< Buckets of an incremental rehash in progress, or nullptr.
+        std::size_t oldBuckets_;  ///< Number of old buckets; buckets_ / 2 while old_ is set.
+        std::size_t split_;       ///< Leading old buckets already split (and destroyed).
+        std::size_t size_;        ///< Number of elements.
+        float maxLoadFactor_ = 0.75f; ///< Maximum allowed load factor.
+
+        /// Returns Hash's result for @p key after the finalizer.
+        template<typename K>
+        static std::size_t mixedHash(const K& key) {
+            return static_cast<std::size_t>(Mix{}(Hash{}(key)));
+        }
+
+        /// Returns the bucket currently holding the keys with mixed hash @p h.
+        Bucket& bucketOf(std::size_t h) {
+            if (old_) {
+                std::size_t j = h & (oldBuckets_ - 1);
+                if (j >= split_)
+                    return old_[j];
+            }
+            return table_[h & (buckets_ - 1)];
+        }
+
+        /// Smallest power-of-two bucket count keeping @p count entries within maxLoadFactor_.
+        std::size_t bucketsFor(std::size_t count) const;
+
+        /// Doubles the bucket count, at once or incrementally.
+        void grow();
+
+        /// Finishes any incremental rehash, then redistributes the entries over @p buckets buckets.
+        void rehash(std::size_t buckets);
+
+        /// Splits up to @p count more old buckets; frees old_ when none are left.
+        void split(std::size_t count);
+
+        /// Splices the nodes of @p cell into their buckets of table_.
+        void moveNodes(Bucket& cell);
+
+        /// Allocates @p count buckets without constructing them.
+        static Bucket* allocate(std::size_t count) { return std::allocator<Bucket>().allocate(count); }
+
+        /// Destroys the constructed buckets, with their entries, and frees both arrays.
+        void release();
+    };
+};
+
+/// The default chained layout, mixing hashes with WyMix.
+using SeparateChaining = BasicSeparateChaining<>;
+
+/// Chained layout that spreads each rehash over later inserts and removes.
+using IncrementalChaining = BasicSeparateChaining<WyMix, true>;
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::Table(std::size_t buckets)
+    : table_(nullptr), buckets_(1), old_(nullptr), oldBuckets_(0), split_(0), size_(0) {
+    while (buckets_ < buckets)
+        buckets_ *= 2;
+    table_ = allocate(buckets_);
+    std::uninitialized_value_construct_n(table_, buckets_);
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::Table(const Table& other)
+    : Table(other.buckets_) {
+    maxLoadFactor_ = other.maxLoadFactor_;
+    auto copyFrom = [this](const Bucket& cell) {
+        for (const auto& pair : cell)
+            table_[mixedHash(pair.first) & (buckets_ - 1)].push_back(pair);
+    };
+    // A partly split table is copied as fully split. If a copy throws, the
+    // destructor frees what was copied, as the delegated constructor finished.
+    if (other.old_) {
+        for (std::size_t j = 0; j < other.oldBuckets_; ++j) {
+            if (j < other.split_) {
+                copyFrom(other.table_[j]);
+                copyFrom(other.table_[j + other.oldBuckets_]);
+            } else {
+                copyFrom(other.old_[j]);
+            }
+        }
+    } else {
+        for (std::size_t i = 0; i < buckets_; ++i)
+            copyFrom(other.table_[i]);
+    }
+    size_ = other.size_;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::Table(Table&& other)
+    : Table(1) {
+    std::swap(table_, other.table_);
+    std::swap(buckets_, other.buckets_);
+    std::swap(old_, other.old_);
+    std::swap(oldBuckets_, other.oldBuckets_);
+    std::swap(split_, other.split_);
+    std::swap(size_, other.size_);
+    maxLoadFactor_ = other.maxLoadFactor_;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+typename BasicSeparateChaining<Mix, Incremental>::template Table<Key, Value, Hash>&
+BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::operator=(Table other) noexcept {
+    std::swap(table_, other.table_);
+    std::swap(buckets_, other.buckets_);
+    std::swap(old_, other.old_);
+    std::swap(oldBuckets_, other.oldBuckets_);
+    std::swap(split_, other.split_);
+    std::swap(size_, other.size_);
+    std::swap(maxLoadFactor_, other.maxLoadFactor_);
+    return *this;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::~Table() {
+    release();
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::release() {
+    if (old_) {
+        for (std::size_t j = 0; j < oldBuckets_; ++j) {
+            if (j < split_) {
+                table_[j].~Bucket();
+                table_[j + oldBuckets_].~Bucket();
+            } else {
+                old_[j].~Bucket();
+            }
+        }
+        std::allocator<Bucket>().deallocate(old_, oldBuckets_);
+        old_ = nullptr;
+    } else if (table_) {
+        std::destroy_n(table_, buckets_);
+    }
+    if (table_)
+        std::allocator<Bucket>().deallocate(table_, buckets_);
+    table_ = nullptr;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+template<typename... Args>
+std::pair<Value*, bool>
+BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::tryEmplace(const Key& key, Args&&... args) {
+    if (old_)
+        split(splitStep);
+    Bucket& cell = bucketOf(mixedHash(key));
+    for (auto& pair : cell)
+        if (pair.first == key)
+            return {&pair.second, false};
+    cell.emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                      std::forward_as_tuple(std::forward<Args>(args)...));
+    Value* value = &cell.back().second;
+    ++size_;
+    // Nodes are spliced, never copied, so value stays valid across the rehash.
+    if (static_cast<float>(size_) / buckets_ > maxLoadFactor_)
+        grow();
+    return {value, true};
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+template<typename K>
+Value* BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::find(const K& key) {
+    for (auto& pair : bucketOf(mixedHash(key)))
+        if (pair.first == key)
+            return &pair.second;
+    return nullptr;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+template<typename F>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::forEach(F& fn) const {
+    auto visit = [&fn](const Bucket& cell) {
+        for (const auto& pair : cell)
+            fn(pair.first, pair.second);
+    };
+    if (!old_) {
+        for (std::size_t i = 0; i < buckets_; ++i)
+            visit(table_[i]);
+        return;
+    }
+    for (std::size_t j = 0; j < oldBuckets_; ++j) {
+        if (j < split_) {
+            visit(table_[j]);
+            visit(table_[j + oldBuckets_]);
+        } else {
+            visit(old_[j]);
+        }
+    }
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::remove(const Key& key) {
+    if (old_)
+        split(splitStep);
+    Bucket& cell = bucketOf(mixedHash(key));
+    for (auto it = cell.begin(); it != cell.end(); ++it) {
+        if (it->first == key) {
+            cell.erase(it);
+            --size_;
+            return;
+        }
+    }
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+std::size_t BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::bucketsFor(std::size_t count) const {
+    std::size_t buckets = 1;
+    while (static_cast<float>(count) / buckets > maxLoadFactor_)
+        buckets *= 2;
+    return buckets;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::reserve(std::size_t count) {
+    // An explicit reservation is paid for up front, even in incremental mode.
+    std::size_t buckets = bucketsFor(count);
+    if (buckets > buckets_)
+        rehash(buckets);
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::maxLoadFactor(float factor) {
+    if (!(factor > 0.0f))
+        throw std::invalid_argument("max load factor must be positive");
+    maxLoadFactor_ = factor;
+    reserve(size_);
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::grow() {
+    if (!Incremental) {
+        rehash(buckets_ * 2);
+        return;
+    }
+    // A rehash still in progress when the table fills again is finished first.
+    split(oldBuckets_);
+    Bucket* doubled = allocate(buckets_ * 2);
+    old_ = table_;
+    oldBuckets_ = buckets_;
+    table_ = doubled;
+    buckets_ *= 2;
+    split_ = 0;
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::rehash(std::size_t buckets) {
+    split(oldBuckets_);
+    Bucket* grown = allocate(buckets);
+    std::uninitialized_value_construct_n(grown, buckets);
+    std::swap(table_, grown);
+    std::swap(buckets_, buckets);
+    for (std::size_t i = 0; i < buckets; ++i) {
+        moveNodes(grown[i]);
+        grown[i].~Bucket();
+    }
+    std::allocator<Bucket>().deallocate(grown, buckets);
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::split(std::size_t count) {
+    if (!old_)
+        return;
+    for (; count > 0 && split_ < oldBuckets_; --count, ++split_) {
+        new (table_ + split_) Bucket();
+        new (table_ + split_ + oldBuckets_) Bucket();
+        moveNodes(old_[split_]);
+        old_[split_].~Bucket();
+    }
+    if (split_ == oldBuckets_) {
+        std::allocator<Bucket>().deallocate(old_, oldBuckets_);
+        old_ = nullptr;
+        oldBuckets_ = 0;
+        split_ = 0;
+    }
+}
+
+template<typename Mix, bool Incremental>
+template<typename Key, typename Value, typename Hash>
+void BasicSeparateChaining<Mix, Incremental>::Table<Key, Value, Hash>::moveNodes(Bucket& cell) {
+    while (!cell.empty()) {
+        Bucket& dest = table_[mixedHash(cell.front().first) & (buckets_ - 1)];
+        dest.splice(dest.end(), cell, cell.begin());
+    }
+}
+
+} // namespace dsa
+
+#endif // DSA_HASHLAYOUT_HPP
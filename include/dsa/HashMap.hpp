@@ -1,47 +1,82 @@
 /**
  * @file HashMap.hpp
- * @brief Declares a hash map using separate chaining.
+ * @brief Declares a hash map with a selectable storage layout.
+ *
+ * By default entries are chained in per-bucket lists (SeparateChaining).
+ * Passing SwissTable (see SwissTable.hpp) or RobinHood (see
+ * RobinHoodTable.hpp) as the third template argument stores them in one
+ * flat open-addressing array instead, which avoids a pointer dereference
+ * per entry: SwissTable probes many slots per instruction, and RobinHood
+ * keeps probe lengths short and even at load factors up to 0.9.
+ *
+ * find() returns a pointer to the stored value, so a hit copies nothing.
+ * With a transparent Hash, such as the default one for std::string keys,
+ * find(), contains() and get() also accept any key type the hash and
+ * operator== take, e.g. std::string_view or const char*, without building
+ * a temporary Key.
+ *
+ * @section Example
+ * @code
+ * dsa::HashMap<std::string, int> ages;
+ * ages["ada"] = 36;
+ * if (const int* age = ages.find(std::string_view("ada"))) { ... }
+ * @endcode
  */
 
  #ifndef DSA_HASHMAP_HPP
  #define DSA_HASHMAP_HPP
- 
- #include <vector>
- #include <list>
- #include <utility>
- #include <functional>
- #include <stdexcept>
- 
+
+ #include <cstddef>
+ #include <type_traits>
+ #include "HashLayout.hpp"
+ #include "RobinHoodTable.hpp"
+ #include "SwissTable.hpp"
+
  namespace dsa {
- 
+
  /**
   * @class HashMap
   * @brief A hash map implementation.
   *
-  * Uses separate chaining for collision resolution and supports dynamic rehashing.
+  * Forwards every operation to the table of its Layout policy.
   *
   * @tparam Key Type of keys.
   * @tparam Value Type of values.
+  * @tparam Layout Storage layout: SeparateChaining (default), IncrementalChaining,
+  *         SwissTable or RobinHood.
+  * @tparam Hash Hash function; lookups are heterogeneous if it declares is_transparent.
   */
- template<typename Key, typename Value>
+ template<typename Key, typename Value, typename Layout = SeparateChaining, typename Hash = DefaultHash<Key>>
  class HashMap {
+     using Table = typename Layout::template Table<Key, Value, Hash>;
+
+     /// Enables a lookup by K when Hash is transparent.
+     template<typename K>
+     using Transparent = typename std::enable_if<detail::IsTransparentHash<Hash, K>::value, int>::type;
+
  public:
      /**
       * @brief Constructs a HashMap with a specified number of buckets.
+      *
+      * The chained layout rounds the count up to a power of two. For
+      * open-addressing layouts this is the number of entries the map can
+      * hold before it first grows.
+      *
       * @param buckets Initial number of buckets.
       */
-     HashMap(std::size_t buckets = 10);
- 
-     /// Destructor.
-     ~HashMap() = default;
- 
+     HashMap(std::size_t buckets = 10) : table_(buckets) {}
+
      /**
       * @brief Inserts or updates a key-value pair.
       *
       * @param key Key to insert.
       * @param value Value associated with the key.
       */
-     void put(const Key& key, const Value& value);
+     void put(const Key& key, const Value& value) {
+         auto result = table_.tryEmplace(key, value);
+         if (!result.second)
+             *result.first = value;
+     }
 
      /**
       * @brief Alias for put method.
@@ -50,7 +85,7 @@
       * @param value Value associated with the key.
       */
      void insert(const Key& key, const Value& value) { put(key, value); }
- 
+
      /**
       * @brief Retrieves the value associated with a key.
       *
@@ -58,96 +93,102 @@
       * @param value Reference to store the found value.
       * @return True if key is found, false otherwise.
       */
-     bool get(const Key& key, Value& value) const;
- 
+     bool get(const Key& key, Value& value) const { return copyOut(find(key), value); }
+     /// Heterogeneous get(); available when Hash is transparent.
+     template<typename K, Transparent<K> = 0>
+     bool get(const K& key, Value& value) const { return copyOut(find(key), value); }
+
+     /// Returns a pointer to the value of @p key, or nullptr if absent.
+     Value* find(const Key& key) { return table_.find(key); }
+     /// Const version of find().
+     const Value* find(const Key& key) const { return const_cast<Table&>(table_).find(key); }
+     /// Heterogeneous find(); available when Hash is transparent.
+     template<typename K, Transparent<K> = 0>
+     Value* find(const K& key) { return table_.find(key); }
+     /// Heterogeneous const find(); available when Hash is transparent.
+     template<typename K, Transparent<K> = 0>
+     const Value* find(const K& key) const { return const_cast<Table&>(table_).find(key); }
+
+     /// Checks whether @p key is present.
+     bool contains(const Key& key) const { return find(key) != nullptr; }
+     /// Heterogeneous contains(); available when Hash is transparent.
+     template<typename K, Transparent<K> = 0>
+     bool contains(const K& key) const { return find(key) != nullptr; }
+
+     /// Returns the value for @p key, inserting a value-initialized one if absent.
+     Value& operator[](const Key& key) { return *table_.tryEmplace(key).first; }
+
      /**
       * @brief Removes a key-value pair.
       *
       * @param key Key to remove.
       */
-     void remove(const Key& key);
- 
- private:
-     std::vector<std::list<std::pair<Key, Value>>> table_; ///< Underlying table.
-     std::size_t buckets_;  ///< Number of buckets.
-     std::size_t size_;     ///< Number of elements.
-     const float maxLoadFactor_ = 0.75f; ///< Maximum allowed load factor.
- 
+     void remove(const Key& key) { table_.remove(key); }
+
+     /// Returns the number of key-value pairs.
+     std::size_t size() const { return table_.size(); }
+
+     /// Checks if the map is empty.
+     bool empty() const { return table_.size() == 0; }
+
      /**
-      * @brief Computes the hash for a key.
-      * @param key Key to hash.
-      * @return Bucket index.
+      * @brief Calls @p fn(key, value) for every entry, in no particular order.
+      *
+      * @param fn Callable taking (const Key&, const Value&); must not modify the map.
       */
-     std::size_t hash(const Key& key) const;
- 
-     /// Rehashes the table when load factor exceeds maxLoadFactor_.
-     void rehash();
- };
- 
- template<typename Key, typename Value>
- HashMap<Key, Value>::HashMap(std::size_t buckets)
-     : buckets_(buckets), size_(0) {
-     table_.resize(buckets_);
- }
- 
- template<typename Key, typename Value>
- std::size_t HashMap<Key, Value>::hash(const Key& key) const {
-     return std::hash<Key>{}(key) % buckets_;
- }
- 
- template<typename Key, typename Value>
- void HashMap<Key, Value>::put(const Key& key, const Value& value) {
-     std::size_t index = hash(key);
-     for (auto& pair : table_[index]) {
-         if (pair.first == key) {
-             pair.second = value;
-             return;
-         }
-     }
-     table_[index].push_back({key, value});
-     ++size_;
-     if (static_cast<float>(size_) / buckets_ > maxLoadFactor_)
-         rehash();
- }
- 
- template<typename Key, typename Value>
- bool HashMap<Key, Value>::get(const Key& key, Value& value) const {
-     std::size_t index = hash(key);
-     for (const auto& pair : table_[index])
-         if (pair.first == key) {
-             value = pair.second;
-             return true;
-         }
-     return false;
- }
- 
- template<typename Key, typename Value>
- void HashMap<Key, Value>::remove(const Key& key) {
-     std::size_t index = hash(key);
-     auto& cell = table_[index];
-     for (auto it = cell.begin(); it != cell.end(); ++it) {
-         if (it->first == key) {
-             cell.erase(it);
-             --size_;
-             return;
-         }
-     }
- }
- 
- template<typename Key, typename Value>
- void HashMap<Key, Value>::rehash() {
-     buckets_ *= 2;
-     std::vector<std::list<std::pair<Key, Value>>> newTable(buckets_);
-     for (const auto& cell : table_) {
-         for (const auto& pair : cell) {
-             std::size_t index = std::hash<Key>{}(pair.first) % buckets_;
-             newTable[index].push_back(pair);
-         }
+     template<typename F>
+     void for_each(F&& fn) const { table_.forEach(fn); }
+
+     /// Returns the number of buckets (slots, for open-addressing layouts).
+     std::size_t bucket_count() const { return table_.bucketCount(); }
+
+     /// Returns the number of entries per bucket.
+     float load_factor() const { return bucket_count() ? static_cast<float>(size()) / bucket_count() : 0.0f; }
+
+     /// Returns the load factor above which the map grows.
+     float max_load_factor() const { return table_.maxLoadFactor(); }
+
+     /**
+      * @brief Sets the load factor above which the map grows.
+      *
+      * Open-addressing layouts cap it at their limit (7/8 for SwissTable,
+      * 0.9 for RobinHood). Grows at once if the map is already above it.
+      *
+      * @param factor New maximum load factor.
+      * @throws std::invalid_argument unless @p factor > 0.
+      */
+     void max_load_factor(float factor) { table_.maxLoadFactor(factor); }
+
+     /**
+      * @brief Grows the map so that @p count entries fit without rehashing.
+      *
+      * @param count Number of entries to make room for.
+      */
+     void reserve(std::size_t count) { table_.reserve(count); }
+
+ private:
+     Table table_; ///< Storage for the entries.
+
+     static bool copyOut(const Value* found, Value& value) {
+         if (!found)
+             return false;
+         value = *found;
+         return true;
      }
-     table_.swap(newTable);
- }
- 
+ };
+
+ /// A chained HashMap whose rehashes are spread over later inserts and removes.
+ template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+ using IncrementalHashMap = HashMap<Key, Value, IncrementalChaining, Hash>;
+
+ /// A HashMap stored as a flat, SIMD-probed Swiss table.
+ template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+ using SwissHashMap = HashMap<Key, Value, SwissTable, Hash>;
+
+ /// A HashMap stored as a flat Robin Hood table.
+ template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+ using RobinHoodHashMap = HashMap<Key, Value, RobinHood, Hash>;
+
  } // namespace dsa
- 
+
  #endif // DSA_HASHMAP_HPP
- 
\ No newline at end of file
@@ -6,9 +6,13 @@
  #ifndef DSA_LINKEDLIST_HPP
  #define DSA_LINKEDLIST_HPP
  
+ #include <algorithm>
  #include <cstddef>
+ #include <new>
  #include <stdexcept>
  #include <iterator>
+ #include <type_traits>
+ #include <utility>
  
  namespace dsa {
  
@@ -35,6 +39,11 @@
   *
   * Provides methods to add and remove elements, and supports iteration.
   *
+  * Nodes are carved out of blocks owned by the list rather than allocated
+  * one by one. Removed nodes go on a free list and are reused by later
+  * insertions. The blocks are freed whenever the list becomes empty, and
+  * shrink_to_fit() returns the spare room of a list that has shrunk.
+  *
   * @tparam T Type of elements stored in the list.
   */
  template<typename T>
@@ -70,6 +79,50 @@
 
      /// Removes the last element.
      void pop_back();
+
+     /**
+      * @brief Appends the elements of [first, last) in order.
+      *
+      * The new nodes are linked into a private chain and spliced onto the
+      * tail once, so head/tail/size are updated a single time per batch.
+      * For forward iterators, room for the whole range is reserved up
+      * front, taking at most one block allocation.
+      *
+      * @param first Iterator to the first element.
+      * @param last Iterator past the last element.
+      */
+     template<typename InputIt>
+     void push_back_range(InputIt first, InputIt last);
+
+     /**
+      * @brief Prepends the elements of [first, last), each in front of the previous.
+      *
+      * Equivalent to calling push_front for every element, so the last
+      * element of the range ends up first. Nodes are reserved up front as in
+      * push_back_range.
+      *
+      * @param first Iterator to the first element.
+      * @param last Iterator past the last element.
+      */
+     template<typename InputIt>
+     void push_front_range(InputIt first, InputIt last);
+
+     /**
+      * @brief Removes up to n elements from the front, moving them to out.
+      * @param out Output iterator receiving the removed elements in order.
+      * @param n Maximum number of elements to remove.
+      * @return Number of elements removed.
+      */
+     template<typename OutputIt>
+     std::size_t pop_front_n(OutputIt out, std::size_t n);
+ 
+     /**
+      * @brief Frees the node storage that the current elements do not need.
+      *
+      * Copies the elements into a single block of exactly size() nodes, so
+      * it takes O(n) time; the list is unchanged if a copy throws.
+      */
+     void shrink_to_fit();
  
      /// Checks if the list is empty.
      bool empty() const;
@@ -136,19 +189,55 @@
      iterator end() { return iterator(nullptr); }
  
  private:
+     /// Storage for one node; while free, it holds the next free slot instead.
+     struct alignas(Node<T>) Slot {
+         unsigned char bytes[sizeof(Node<T>)];
+     };
+ 
      Node<T>* head_;      ///< Pointer to the first node.
      Node<T>* tail_;      ///< Pointer to the last node.
      std::size_t size_;   ///< Number of nodes in the list.
+     Slot* blocks_;       ///< Newest block; each block's first slot links to the previous one.
+     Slot* free_;         ///< Slots of removed nodes, linked through their storage.
+     Slot* fresh_;        ///< First never-used slot of the newest block.
+     std::size_t freshLeft_; ///< Never-used slots from fresh_ on.
+     std::size_t capacity_;  ///< Node slots across all blocks.
  
      /// Copies nodes from another list.
      void copyFrom(const LinkedList& other);
  
      /// Clears all nodes.
      void clear();
+ 
+     /// Constructs a node holding value in a pooled slot.
+     Node<T>* makeNode(const T& value);
+ 
+     /// Destroys a node and returns its slot to the free list.
+     void destroyNode(Node<T>* node);
+ 
+     /// Takes a slot from the free list, else from the newest block.
+     Slot* takeSlot();
+ 
+     /// Puts a slot on the free list.
+     void releaseSlot(Slot* slot);
+ 
+     /// Makes sure n more nodes fit without further allocation.
+     void reserveNodes(std::size_t n);
+ 
+     /// Allocates a block of count slots, freeing the rest of the previous one.
+     void addBlock(std::size_t count);
+ 
+     /// Frees every block; no node may be alive.
+     void releaseBlocks();
+ 
+     /// Reads the link stored in a free slot or block header.
+     static Slot* linkOf(Slot* slot) { return *std::launder(reinterpret_cast<Slot**>(slot)); }
  };
  
  template<typename T>
- LinkedList<T>::LinkedList() : head_(nullptr), tail_(nullptr), size_(0) {}
+ LinkedList<T>::LinkedList()
+     : head_(nullptr), tail_(nullptr), size_(0), blocks_(nullptr), free_(nullptr),
+       fresh_(nullptr), freshLeft_(0), capacity_(0) {}
  
  template<typename T>
  void LinkedList<T>::copyFrom(const LinkedList& other) {
@@ -157,16 +246,26 @@
  }
  
  template<typename T>
- LinkedList<T>::LinkedList(const LinkedList& other)
-     : head_(nullptr), tail_(nullptr), size_(0) {
-     copyFrom(other);
+ LinkedList<T>::LinkedList(const LinkedList& other) : LinkedList() {
+     try {
+         reserveNodes(other.size_);
+         copyFrom(other);
+     } catch (...) {
+         clear();
+         releaseBlocks();
+         throw;
+     }
  }
  
  template<typename T>
  LinkedList<T>::LinkedList(LinkedList&& other) noexcept 
-     : head_(other.head_), tail_(other.tail_), size_(other.size_) {
+     : head_(other.head_), tail_(other.tail_), size_(other.size_), blocks_(other.blocks_),
+       free_(other.free_), fresh_(other.fresh_), freshLeft_(other.freshLeft_),
+       capacity_(other.capacity_) {
      other.head_ = other.tail_ = nullptr;
      other.size_ = 0;
+     other.blocks_ = other.free_ = other.fresh_ = nullptr;
+     other.freshLeft_ = other.capacity_ = 0;
  }
  
  template<typename T>
@@ -174,12 +273,18 @@
      std::swap(head_, other.head_);
      std::swap(tail_, other.tail_);
      std::swap(size_, other.size_);
+     std::swap(blocks_, other.blocks_);
+     std::swap(free_, other.free_);
+     std::swap(fresh_, other.fresh_);
+     std::swap(freshLeft_, other.freshLeft_);
+     std::swap(capacity_, other.capacity_);
      return *this;
  }
  
  template<typename T>
  LinkedList<T>::~LinkedList() {
      clear();
+     releaseBlocks();
  }
  
  template<typename T>
@@ -188,9 +293,78 @@
          pop_front();
  }
  
+ template<typename T>
+ Node<T>* LinkedList<T>::makeNode(const T& value) {
+     Slot* slot = takeSlot();
+     try {
+         return ::new (static_cast<void*>(slot)) Node<T>(value);
+     } catch (...) {
+         releaseSlot(slot);
+         throw;
+     }
+ }
+ 
+ template<typename T>
+ void LinkedList<T>::destroyNode(Node<T>* node) {
+     node->~Node();
+     releaseSlot(reinterpret_cast<Slot*>(node));
+ }
+ 
+ template<typename T>
+ typename LinkedList<T>::Slot* LinkedList<T>::takeSlot() {
+     if (free_) {
+         Slot* slot = free_;
+         free_ = linkOf(slot);
+         return slot;
+     }
+     // Blocks double with the list, up to 4096 nodes each.
+     if (!freshLeft_)
+         addBlock(std::max<std::size_t>(8, std::min<std::size_t>(size_, 4096)));
+     --freshLeft_;
+     return fresh_++;
+ }
+ 
+ template<typename T>
+ void LinkedList<T>::releaseSlot(Slot* slot) {
+     ::new (static_cast<void*>(slot)) Slot*(free_);
+     free_ = slot;
+ }
+ 
+ template<typename T>
+ void LinkedList<T>::reserveNodes(std::size_t n) {
+     const std::size_t spare = capacity_ - size_;
+     if (n > spare)
+         addBlock(std::max<std::size_t>(n - spare, std::min<std::size_t>(size_, 4096)));
+ }
+ 
+ template<typename T>
+ void LinkedList<T>::addBlock(std::size_t count) {
+     Slot* block = static_cast<Slot*>(
+         ::operator new((count + 1) * sizeof(Slot), std::align_val_t(alignof(Slot))));
+     ::new (static_cast<void*>(block)) Slot*(blocks_);
+     blocks_ = block;
+     // Unused slots of the previous block stay reachable through the free list.
+     for (; freshLeft_; --freshLeft_)
+         releaseSlot(fresh_++);
+     fresh_ = block + 1;
+     freshLeft_ = count;
+     capacity_ += count;
+ }
+ 
+ template<typename T>
+ void LinkedList<T>::releaseBlocks() {
+     while (blocks_) {
+         Slot* previous = linkOf(blocks_);
+         ::operator delete(blocks_, std::align_val_t(alignof(Slot)));
+         blocks_ = previous;
+     }
+     free_ = fresh_ = nullptr;
+     freshLeft_ = capacity_ = 0;
+ }
+ 
  template<typename T>
  void LinkedList<T>::push_front(const T& value) {
-     Node<T>* new_node = new Node<T>(value);
+     Node<T>* new_node = makeNode(value);
      new_node->next = head_;
      head_ = new_node;
      if (!tail_)
@@ -200,7 +374,7 @@
  
  template<typename T>
  void LinkedList<T>::push_back(const T& value) {
-     Node<T>* new_node = new Node<T>(value);
+     Node<T>* new_node = makeNode(value);
      if (tail_)
          tail_->next = new_node;
      else
@@ -217,8 +391,10 @@
      head_ = head_->next;
      if (!head_)
          tail_ = nullptr;
-     delete temp;
+     destroyNode(temp);
      --size_;
+     if (!head_)
+         releaseBlocks();
  }
 
  template<typename T>
@@ -228,8 +404,9 @@
      
      if (head_ == tail_) {
          // Only one node
-         delete head_;
+         destroyNode(head_);
          head_ = tail_ = nullptr;
+         releaseBlocks();
      } else {
          // More than one node
          Node<T>* current = head_;
@@ -237,13 +414,109 @@
          while (current->next != tail_)
              current = current->next;
          
-         delete tail_;
+         destroyNode(tail_);
          tail_ = current;
          tail_->next = nullptr;
      }
      --size_;
  }
  
+ template<typename T>
+ template<typename InputIt>
+ void LinkedList<T>::push_back_range(InputIt first, InputIt last) {
+     if (first == last)
+         return;
+     if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                   typename std::iterator_traits<InputIt>::iterator_category>::value)
+         reserveNodes(static_cast<std::size_t>(std::distance(first, last)));
+     Node<T>* chainHead = makeNode(*first);
+     Node<T>* chainTail = chainHead;
+     std::size_t count = 1;
+     try {
+         for (++first; first != last; ++first) {
+             chainTail->next = makeNode(*first);
+             chainTail = chainTail->next;
+             ++count;
+         }
+     } catch (...) {
+         while (chainHead) {
+             Node<T>* next = chainHead->next;
+             destroyNode(chainHead);
+             chainHead = next;
+         }
+         if (!head_)
+             releaseBlocks();
+         throw;
+     }
+     if (tail_)
+         tail_->next = chainHead;
+     else
+         head_ = chainHead;
+     tail_ = chainTail;
+     size_ += count;
+ }
+
+ template<typename T>
+ template<typename InputIt>
+ void LinkedList<T>::push_front_range(InputIt first, InputIt last) {
+     if (first == last)
+         return;
+     if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                   typename std::iterator_traits<InputIt>::iterator_category>::value)
+         reserveNodes(static_cast<std::size_t>(std::distance(first, last)));
+     Node<T>* chainTail = makeNode(*first);
+     Node<T>* chainHead = chainTail;
+     std::size_t count = 1;
+     try {
+         for (++first; first != last; ++first) {
+             Node<T>* node = makeNode(*first);
+             node->next = chainHead;
+             chainHead = node;
+             ++count;
+         }
+     } catch (...) {
+         while (chainHead) {
+             Node<T>* next = chainHead->next;
+             destroyNode(chainHead);
+             chainHead = next;
+         }
+         if (!head_)
+             releaseBlocks();
+         throw;
+     }
+     chainTail->next = head_;
+     head_ = chainHead;
+     if (!tail_)
+         tail_ = chainTail;
+     size_ += count;
+ }
+
+ template<typename T>
+ template<typename OutputIt>
+ std::size_t LinkedList<T>::pop_front_n(OutputIt out, std::size_t n) {
+     std::size_t removed = 0;
+     while (removed < n && head_) {
+         Node<T>* temp = head_;
+         *out++ = std::move(temp->data);
+         head_ = temp->next;
+         destroyNode(temp);
+         --size_;
+         ++removed;
+     }
+     if (!head_) {
+         tail_ = nullptr;
+         releaseBlocks();
+     }
+     return removed;
+ }
+
+ template<typename T>
+ void LinkedList<T>::shrink_to_fit() {
+     // The copy constructor reserves exactly size_ nodes in one block.
+     if (capacity_ > size_)
+         *this = LinkedList(*this);
+ }
+ 
  template<typename T>
  bool LinkedList<T>::empty() const {
      return size_ == 0;
@@ -0,0 +1,195 @@
+/**
+ * @file MPMCQueue.hpp
+ * @brief Defines a bounded multi-producer/multi-consumer lock-free array queue.
+ *
+ * Each slot carries a sequence number that tells producers and consumers
+ * whether the slot is ready for them (Dmitry Vyukov's bounded MPMC design).
+ * A single compare-and-swap on the shared enqueue or dequeue position claims
+ * a slot; the slot's sequence number then hands it to the other side.
+ *
+ * @section Complexity
+ * - try_enqueue/try_dequeue: O(1), lock-free
+ * - size/empty: O(1) (a snapshot; may be stale under concurrent use)
+ *
+ * @section Example
+ * @code
+ * dsa::MPMCQueue<int> queue(1024);
+ * queue.try_enqueue(42);   // from any thread
+ * int x;
+ * queue.try_dequeue(x);    // from any thread
+ * @endcode
+ */
+
+#ifndef DSA_MPMCQUEUE_HPP
+#define DSA_MPMCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include "Utilities.hpp"
+
+namespace dsa {
+
+/**
+ * @class MPMCQueue
+ * @brief A bounded lock-free queue for any number of producers and consumers.
+ *
+ * The capacity is rounded up to a power of two (minimum two) so positions can
+ * be mapped to slots with a mask.
+ *
+ * @tparam T Type of elements. Must be default constructible and assignable.
+ *
+ * @section Thread Safety
+ * All member functions may be called concurrently from any thread.
+ */
+template<typename T>
+class MPMCQueue {
+public:
+    /**
+     * @brief Constructs a queue able to hold at least @p capacity elements.
+     *
+     * @param capacity Minimum number of elements; rounded up to a power of two.
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit MPMCQueue(std::size_t capacity);
+
+    /// Destructor.
+    ~MPMCQueue();
+
+    MPMCQueue(const MPMCQueue&) = delete;
+    MPMCQueue& operator=(const MPMCQueue&) = delete;
+
+    /**
+     * @brief Attempts to append an element.
+     * @param value Element to be added.
+     * @return True on success, false if the queue is full.
+     */
+    bool try_enqueue(const T& value);
+
+    /**
+     * @brief Attempts to append an element using move semantics.
+     * @param value Element to be added.
+     * @return True on success, false if the queue is full.
+     */
+    bool try_enqueue(T&& value);
+
+    /**
+     * @brief Attempts to remove the oldest element.
+     * @param out Receives the removed element.
+     * @return True on success, false if the queue is empty.
+     */
+    bool try_dequeue(T& out);
+
+    /// Returns true if the queue appeared empty at the time of the call.
+    bool empty() const { return size() == 0; }
+
+    /// Returns the number of elements at the time of the call.
+    std::size_t size() const;
+
+    /// Returns the maximum number of elements the queue can hold.
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    /// A slot and the sequence number that says whose turn it is.
+    struct Cell {
+        std::atomic<std::size_t> sequence; ///< Position this slot is ready for.
+        T data;                            ///< Stored element.
+    };
+
+    /// Shared implementation of the try_enqueue overloads.
+    template<typename U>
+    bool enqueueOne(U&& value);
+
+    // Read-only after construction.
+    alignas(cacheLineSize) Cell* buffer_;  ///< Slot storage.
+    std::size_t mask_;                     ///< capacity() - 1.
+
+    alignas(cacheLineSize) std::atomic<std::size_t> enqueuePos_; ///< Next position to fill.
+    alignas(cacheLineSize) std::atomic<std::size_t> dequeuePos_; ///< Next position to drain.
+};
+
+template<typename T>
+MPMCQueue<T>::MPMCQueue(std::size_t capacity)
+    : buffer_(nullptr), mask_(0), enqueuePos_(0), dequeuePos_(0) {
+    if (capacity == 0)
+        throw std::invalid_argument("MPMCQueue capacity must be positive");
+    std::size_t cap = 2;
+    while (cap < capacity)
+        cap <<= 1;
+    buffer_ = new Cell[cap];
+    mask_ = cap - 1;
+    for (std::size_t i = 0; i < cap; ++i)
+        buffer_[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+template<typename T>
+MPMCQueue<T>::~MPMCQueue() {
+    delete[] buffer_;
+}
+
+template<typename T>
+bool MPMCQueue<T>::try_enqueue(const T& value) {
+    return enqueueOne(value);
+}
+
+template<typename T>
+bool MPMCQueue<T>::try_enqueue(T&& value) {
+    return enqueueOne(std::move(value));
+}
+
+template<typename T>
+template<typename U>
+bool MPMCQueue<T>::enqueueOne(U&& value) {
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &buffer_[pos & mask_];
+        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // Slot still holds an element from the previous lap.
+        } else {
+            pos = enqueuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    cell->data = std::forward<U>(value);
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+bool MPMCQueue<T>::try_dequeue(T& out) {
+    std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell* cell;
+    for (;;) {
+        cell = &buffer_[pos & mask_];
+        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+        if (diff == 0) {
+            if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            return false; // Slot has not been filled for this lap yet.
+        } else {
+            pos = dequeuePos_.load(std::memory_order_relaxed);
+        }
+    }
+    out = std::move(cell->data);
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+std::size_t MPMCQueue<T>::size() const {
+    std::size_t head = dequeuePos_.load(std::memory_order_acquire);
+    std::size_t tail = enqueuePos_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+}
+
+} // namespace dsa
+
+#endif // DSA_MPMCQUEUE_HPP
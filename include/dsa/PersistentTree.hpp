@@ -0,0 +1,499 @@
+/**
+ * @file PersistentTree.hpp
+ * @brief Defines a persistent (path-copying) AVL tree with snapshot reads.
+ *
+ * Nodes are never modified once published. An update copies only the nodes
+ * on the path it changes, links the copies to the untouched subtrees of the
+ * current version, and publishes the new root with a single atomic store.
+ * Readers take a Snapshot, which pins one version in O(1) and can be
+ * queried without locks while writers keep going.
+ *
+ * Nodes replaced by an update stay alive while any snapshot might still
+ * reach them, using epoch-based reclamation. A snapshot announces the
+ * global epoch in a reader slot before loading the root. Replaced nodes are
+ * retired with the epoch current when they were unlinked, and are freed
+ * once every announced epoch is newer.
+ *
+ * @section Complexity
+ * - insert/remove: O(log n) time, O(log n) new nodes
+ * - snapshot(): O(1) (a scan for a free reader slot)
+ * - Snapshot::contains/lower_bound: O(log n); Snapshot::size: O(1)
+ *
+ * @section Example
+ * @code
+ * dsa::PersistentTree<int> index;
+ * index.insert(1);
+ * auto view = index.snapshot();   // from any thread
+ * index.insert(2);                // view still sees only {1}
+ * bool has2 = view.contains(2);   // false
+ * @endcode
+ */
+
+#ifndef DSA_PERSISTENTTREE_HPP
+#define DSA_PERSISTENTTREE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Utilities.hpp"
+
+namespace dsa {
+
+/**
+ * @class PersistentTree
+ * @brief A balanced ordered set with lock-free, consistent snapshot reads.
+ *
+ * Elements are ordered with operator< only; duplicates are ignored.
+ *
+ * @tparam T Type of elements. Must be copy constructible.
+ *
+ * @section Thread Safety
+ * Any number of threads may call insert(), remove() and snapshot()
+ * concurrently; updates serialize on an internal mutex, while snapshots
+ * never block on updates. All snapshots must be destroyed before the tree.
+ */
+template<typename T>
+class PersistentTree {
+    /// Immutable once published; version identifies the update that created it.
+    struct Node {
+        T data;                ///< Stored element.
+        Node* left;            ///< Left child.
+        Node* right;           ///< Right child.
+        std::size_t size;      ///< Number of nodes in this subtree.
+        int height;            ///< AVL height (a leaf has height 1).
+        std::uint64_t version; ///< Update that allocated the node.
+
+        Node(const T& value, std::uint64_t ver)
+            : data(value), left(nullptr), right(nullptr), size(1), height(1), version(ver) {}
+    };
+
+    /// A reader's announced epoch; 0 while the slot is free.
+    struct alignas(cacheLineSize) ReaderSlot {
+        std::atomic<std::uint64_t> epoch{0};
+    };
+
+public:
+    /**
+     * @brief A pinned, immutable version of the tree.
+     *
+     * Move-only. Holding a snapshot keeps the nodes of its version alive,
+     * so long-lived snapshots delay reclamation.
+     */
+    class Snapshot {
+    public:
+        Snapshot(const Snapshot&) = delete;
+        Snapshot& operator=(const Snapshot&) = delete;
+        /// Move constructor.
+        Snapshot(Snapshot&& other) noexcept : root_(other.root_), slot_(other.slot_) {
+            other.slot_ = nullptr;
+        }
+        /// Releases the reader slot.
+        ~Snapshot() {
+            if (slot_)
+                slot_->epoch.store(0, std::memory_order_release);
+        }
+
+        /// Checks whether the version contains an element equivalent to @p value.
+        bool contains(const T& value) const;
+
+        /**
+         * @brief Finds the smallest element not less than @p value.
+         * @return Pointer to the element, valid while the snapshot lives; nullptr if none.
+         */
+        const T* lower_bound(const T& value) const;
+
+        /// Returns the number of elements in the version.
+        std::size_t size() const { return root_ ? root_->size : 0; }
+        /// Checks if the version is empty.
+        bool empty() const { return root_ == nullptr; }
+
+        /// Calls f(element) for every element in ascending order.
+        template<typename Func>
+        void for_each(Func f) const;
+
+    private:
+        Snapshot(const Node* root, ReaderSlot* slot) : root_(root), slot_(slot) {}
+        const Node* root_;  ///< Root of the pinned version.
+        ReaderSlot* slot_;  ///< Announcement keeping the version alive.
+        friend class PersistentTree;
+    };
+
+    /**
+     * @brief Constructs an empty tree.
+     * @param maxReaders Number of snapshots that can be held at once; further
+     *        snapshot() calls wait for a slot.
+     * @throws std::invalid_argument if maxReaders is zero.
+     */
+    explicit PersistentTree(std::size_t maxReaders = 64);
+    /// Destructor; frees every version. No snapshots may be alive.
+    ~PersistentTree();
+
+    PersistentTree(const PersistentTree&) = delete;
+    PersistentTree& operator=(const PersistentTree&) = delete;
+
+    /**
+     * @brief Inserts a value and publishes the new version.
+     * @return True if inserted, false if an equivalent value was present.
+     */
+    bool insert(const T& value);
+
+    /**
+     * @brief Removes a value and publishes the new version.
+     * @return True if removed, false if not found.
+     */
+    bool remove(const T& value);
+
+    /// Pins the current version for lock-free reads.
+    Snapshot snapshot() const;
+
+    /// Checks whether the current version contains @p value.
+    bool contains(const T& value) const { return snapshot().contains(value); }
+    /// Returns the number of elements in the current version.
+    std::size_t size() const { return snapshot().size(); }
+
+    /// Returns the number of replaced nodes not yet freed.
+    std::size_t retired() const {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        return retired_.size();
+    }
+
+private:
+    std::atomic<Node*> root_;                      ///< Current version.
+    mutable std::atomic<std::uint64_t> epoch_;     ///< Global epoch, starts at 1.
+    std::unique_ptr<ReaderSlot[]> slots_;          ///< Reader announcements.
+    const std::size_t slotCount_;                  ///< Length of slots_.
+
+    mutable std::mutex writeMutex_;                ///< Serializes updates.
+    std::uint64_t version_;                        ///< Current update number.
+    std::vector<Node*> fresh_;                     ///< Nodes allocated by the current update.
+    std::vector<Node*> replaced_;                  ///< Nodes unlinked by the current update.
+    std::vector<std::pair<std::uint64_t, Node*>> retired_; ///< Unlinked nodes and their epochs.
+
+    /// Allocates a node owned by the current update.
+    Node* makeNode(const T& value);
+    /// Returns a node the current update may modify: n itself if fresh, else a copy.
+    Node* own(Node* n);
+
+    static int heightOf(const Node* n) { return n ? n->height : 0; }
+    static std::size_t sizeOf(const Node* n) { return n ? n->size : 0; }
+    static void update(Node* n);
+    Node* rotateLeft(Node* n);
+    Node* rotateRight(Node* n);
+    /// Restores the AVL property at an owned node; returns the subtree root.
+    Node* balance(Node* n);
+
+    Node* insert(Node* n, const T& value, bool& inserted);
+    Node* remove(Node* n, const T& value, bool& removed);
+    /// Unlinks the minimum of n's subtree into @p min; returns the new subtree.
+    Node* removeMin(Node* n, Node*& min);
+
+    /// Publishes the result of an update or discards it on failure.
+    template<typename Op>
+    bool commit(Op op);
+    /// Frees retired nodes that no snapshot can reach anymore.
+    void reclaim();
+    /// Frees every node of one version.
+    static void destroy(Node* n);
+};
+
+template<typename T>
+PersistentTree<T>::PersistentTree(std::size_t maxReaders)
+    : root_(nullptr), epoch_(1), slotCount_(maxReaders), version_(0) {
+    if (maxReaders == 0)
+        throw std::invalid_argument("PersistentTree needs at least one reader slot");
+    slots_.reset(new ReaderSlot[maxReaders]);
+}
+
+template<typename T>
+PersistentTree<T>::~PersistentTree() {
+    destroy(root_.load(std::memory_order_relaxed));
+    for (auto& entry : retired_)
+        delete entry.second;
+}
+
+template<typename T>
+void PersistentTree<T>::destroy(Node* n) {
+    // Versions are O(log n) deep, so an explicit stack stays small.
+    std::vector<Node*> stack;
+    if (n)
+        stack.push_back(n);
+    while (!stack.empty()) {
+        Node* top = stack.back();
+        stack.pop_back();
+        if (top->left)
+            stack.push_back(top->left);
+        if (top->right)
+            stack.push_back(top->right);
+        delete top;
+    }
+}
+
+template<typename T>
+typename PersistentTree<T>::Snapshot PersistentTree<T>::snapshot() const {
+    std::size_t start = std::hash<std::thread::id>()(std::this_thread::get_id()) % slotCount_;
+    for (;;) {
+        for (std::size_t i = 0; i < slotCount_; ++i) {
+            ReaderSlot& slot = slots_[(start + i) % slotCount_];
+            std::uint64_t idle = 0;
+            // Announce first, then load the root: a writer that unlinks nodes
+            // after this load sees the announcement and keeps them alive.
+            if (slot.epoch.compare_exchange_strong(idle, epoch_.load(std::memory_order_seq_cst),
+                                                   std::memory_order_seq_cst))
+                return Snapshot(root_.load(std::memory_order_seq_cst), &slot);
+        }
+        std::this_thread::yield();
+    }
+}
+
+template<typename T>
+bool PersistentTree<T>::Snapshot::contains(const T& value) const {
+    const Node* n = root_;
+    while (n) {
+        if (value < n->data)
+            n = n->left;
+        else if (n->data < value)
+            n = n->right;
+        else
+            return true;
+    }
+    return false;
+}
+
+template<typename T>
+const T* PersistentTree<T>::Snapshot::lower_bound(const T& value) const {
+    const Node* n = root_;
+    const Node* best = nullptr;
+    while (n) {
+        if (n->data < value) {
+            n = n->right;
+        } else {
+            best = n;
+            n = n->left;
+        }
+    }
+    return best ? &best->data : nullptr;
+}
+
+template<typename T>
+template<typename Func>
+void PersistentTree<T>::Snapshot::for_each(Func f) const {
+    std::vector<const Node*> stack;
+    const Node* n = root_;
+    while (n || !stack.empty()) {
+        while (n) {
+            stack.push_back(n);
+            n = n->left;
+        }
+        n = stack.back();
+        stack.pop_back();
+        f(n->data);
+        n = n->right;
+    }
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::makeNode(const T& value) {
+    // Reserve the bookkeeping entry first so a failed push_back cannot leak.
+    fresh_.push_back(nullptr);
+    fresh_.back() = new Node(value, version_);
+    return fresh_.back();
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::own(Node* n) {
+    if (n->version == version_)
+        return n;
+    replaced_.push_back(n);
+    Node* copy = makeNode(n->data);
+    copy->left = n->left;
+    copy->right = n->right;
+    copy->size = n->size;
+    copy->height = n->height;
+    return copy;
+}
+
+template<typename T>
+void PersistentTree<T>::update(Node* n) {
+    int l = heightOf(n->left), r = heightOf(n->right);
+    n->height = 1 + (l > r ? l : r);
+    n->size = 1 + sizeOf(n->left) + sizeOf(n->right);
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::rotateLeft(Node* n) {
+    Node* y = own(n->right);
+    n->right = y->left;
+    y->left = n;
+    update(n);
+    update(y);
+    return y;
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::rotateRight(Node* n) {
+    Node* y = own(n->left);
+    n->left = y->right;
+    y->right = n;
+    update(n);
+    update(y);
+    return y;
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::balance(Node* n) {
+    update(n);
+    int diff = heightOf(n->left) - heightOf(n->right);
+    if (diff > 1) {
+        if (heightOf(n->left->left) < heightOf(n->left->right))
+            n->left = rotateLeft(own(n->left));
+        return rotateRight(n);
+    }
+    if (diff < -1) {
+        if (heightOf(n->right->right) < heightOf(n->right->left))
+            n->right = rotateRight(own(n->right));
+        return rotateLeft(n);
+    }
+    return n;
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::insert(Node* n, const T& value, bool& inserted) {
+    // Recursion depth is bounded by the AVL height, about 1.44 log2(n).
+    if (!n) {
+        inserted = true;
+        return makeNode(value);
+    }
+    if (value < n->data) {
+        Node* left = insert(n->left, value, inserted);
+        if (!inserted)
+            return n;
+        Node* c = own(n);
+        c->left = left;
+        return balance(c);
+    }
+    if (n->data < value) {
+        Node* right = insert(n->right, value, inserted);
+        if (!inserted)
+            return n;
+        Node* c = own(n);
+        c->right = right;
+        return balance(c);
+    }
+    return n;
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::removeMin(Node* n, Node*& min) {
+    if (!n->left) {
+        min = n;
+        replaced_.push_back(n);
+        return n->right;
+    }
+    Node* left = removeMin(n->left, min);
+    Node* c = own(n);
+    c->left = left;
+    return balance(c);
+}
+
+template<typename T>
+typename PersistentTree<T>::Node* PersistentTree<T>::remove(Node* n, const T& value, bool& removed) {
+    if (!n)
+        return nullptr;
+    if (value < n->data) {
+        Node* left = remove(n->left, value, removed);
+        if (!removed)
+            return n;
+        Node* c = own(n);
+        c->left = left;
+        return balance(c);
+    }
+    if (n->data < value) {
+        Node* right = remove(n->right, value, removed);
+        if (!removed)
+            return n;
+        Node* c = own(n);
+        c->right = right;
+        return balance(c);
+    }
+    removed = true;
+    replaced_.push_back(n);
+    if (!n->left)
+        return n->right;
+    if (!n->right)
+        return n->left;
+    // Replace the node with a copy of its successor.
+    Node* min;
+    Node* right = removeMin(n->right, min);
+    Node* c = makeNode(min->data);
+    c->left = n->left;
+    c->right = right;
+    return balance(c);
+}
+
+template<typename T>
+template<typename Op>
+bool PersistentTree<T>::commit(Op op) {
+    std::lock_guard<std::mutex> lock(writeMutex_);
+    ++version_;
+    fresh_.clear();
+    replaced_.clear();
+    bool changed = false;
+    Node* newRoot;
+    try {
+        newRoot = op(root_.load(std::memory_order_relaxed), changed);
+        retired_.reserve(retired_.size() + replaced_.size());
+    } catch (...) {
+        // Nothing was published: drop the private copies, keep the old nodes.
+        for (Node* n : fresh_)
+            delete n;
+        throw;
+    }
+    if (!changed)
+        return false;
+    root_.store(newRoot, std::memory_order_seq_cst);
+    // Readers that announce from now on load the new root.
+    std::uint64_t epoch = epoch_.fetch_add(1, std::memory_order_seq_cst);
+    for (Node* n : replaced_)
+        retired_.emplace_back(epoch, n);
+    reclaim();
+    return true;
+}
+
+template<typename T>
+void PersistentTree<T>::reclaim() {
+    std::uint64_t oldest = UINT64_MAX;
+    for (std::size_t i = 0; i < slotCount_; ++i) {
+        std::uint64_t e = slots_[i].epoch.load(std::memory_order_seq_cst);
+        if (e != 0 && e < oldest)
+            oldest = e;
+    }
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < retired_.size(); ++i) {
+        if (retired_[i].first < oldest)
+            delete retired_[i].second;
+        else
+            retired_[kept++] = retired_[i];
+    }
+    retired_.resize(kept);
+}
+
+template<typename T>
+bool PersistentTree<T>::insert(const T& value) {
+    return commit([&](Node* root, bool& changed) { return insert(root, value, changed); });
+}
+
+template<typename T>
+bool PersistentTree<T>::remove(const T& value) {
+    return commit([&](Node* root, bool& changed) { return remove(root, value, changed); });
+}
+
+} // namespace dsa
+
+#endif // DSA_PERSISTENTTREE_HPP
@@ -0,0 +1,422 @@
+/**
+ * @file PriorityQueue.hpp
+ * @brief Defines d-ary heap priority queues, including an indexed variant.
+ *
+ * Both heaps keep their elements in a DynamicArray in implicit d-ary heap
+ * order. The element that compares greatest under Compare is on top, as with
+ * std::priority_queue; use std::greater<T> for a min-queue (e.g. Dijkstra).
+ * A larger Arity gives a shallower heap: sift-up gets cheaper, while
+ * sift-down compares more children per level. Those children are adjacent
+ * in memory, so the extra comparisons mostly hit the same cache line.
+ *
+ * @section Complexity
+ * - push: O(log_d n)
+ * - pop: O(d log_d n)
+ * - top/size/empty: O(1)
+ * - Range constructor (heapify): O(n)
+ * - IndexedPriorityQueue::decrease_key: O(log_d n)
+ * - IndexedPriorityQueue::erase/update: O(d log_d n)
+ *
+ * @section Example
+ * @code
+ * dsa::PriorityQueue<int, std::greater<int>, 4> pq;  // 4-ary min-heap
+ * pq.push(5);
+ * pq.push(1);
+ * int smallest = pq.top();  // 1
+ *
+ * dsa::IndexedPriorityQueue<int, std::greater<int>> ipq;
+ * auto h = ipq.push(10);
+ * ipq.decrease_key(h, 3);   // moves h towards the top
+ * @endcode
+ */
+
+#ifndef DSA_PRIORITYQUEUE_HPP
+#define DSA_PRIORITYQUEUE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include "Array.hpp"
+
+namespace dsa {
+
+/**
+ * @class PriorityQueue
+ * @brief A d-ary heap with the "greatest" element (under Compare) on top.
+ *
+ * @tparam T Type of elements.
+ * @tparam Compare Strict weak ordering; std::less<T> yields a max-heap.
+ * @tparam Arity Number of children per node (at least 2).
+ */
+template<typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+public:
+    /// Constructs an empty priority queue.
+    explicit PriorityQueue(const Compare& comp = Compare()) : comp_(comp) {}
+
+    /**
+     * @brief Builds a heap from the range [first, last) in linear time.
+     * @param first Iterator to the first element.
+     * @param last Iterator past the last element.
+     * @param comp Comparator instance.
+     */
+    template<typename InputIt>
+    PriorityQueue(InputIt first, InputIt last, const Compare& comp = Compare());
+
+    /// Inserts an element.
+    void push(const T& value);
+    /// Inserts an element (using move semantics).
+    void push(T&& value);
+
+    /**
+     * @brief Removes the top element.
+     * @throws std::out_of_range if the queue is empty.
+     */
+    void pop();
+
+    /**
+     * @brief Returns the top element.
+     * @return Const reference to the top element.
+     * @throws std::out_of_range if the queue is empty.
+     */
+    const T& top() const;
+
+    /// Checks if the queue is empty.
+    bool empty() const { return heap_.empty(); }
+
+    /// Returns the number of elements in the queue.
+    std::size_t size() const { return heap_.size(); }
+
+private:
+    DynamicArray<T> heap_; ///< Elements in d-ary heap order.
+    Compare comp_;         ///< Ordering; the greatest element is on top.
+
+    /// Moves the element at index i up until its parent is not smaller.
+    void siftUp(std::size_t i);
+    /// Moves the element at index i down until no child is greater.
+    void siftDown(std::size_t i);
+};
+
+template<typename T, typename Compare, std::size_t Arity>
+template<typename InputIt>
+PriorityQueue<T, Compare, Arity>::PriorityQueue(InputIt first, InputIt last, const Compare& comp)
+    : comp_(comp) {
+    for (; first != last; ++first)
+        heap_.push_back(*first);
+    // Floyd's heapify: sift down every internal node, last parent first.
+    if (heap_.size() > 1)
+        for (std::size_t i = (heap_.size() - 2) / Arity + 1; i-- > 0;)
+            siftDown(i);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Compare, Arity>::push(const T& value) {
+    heap_.push_back(value);
+    siftUp(heap_.size() - 1);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Compare, Arity>::push(T&& value) {
+    heap_.push_back(std::move(value));
+    siftUp(heap_.size() - 1);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Compare, Arity>::pop() {
+    if (heap_.empty())
+        throw std::out_of_range("PriorityQueue is empty");
+    heap_[0] = std::move(heap_[heap_.size() - 1]);
+    heap_.pop_back();
+    if (!heap_.empty())
+        siftDown(0);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+const T& PriorityQueue<T, Compare, Arity>::top() const {
+    if (heap_.empty())
+        throw std::out_of_range("PriorityQueue is empty");
+    return heap_[0];
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftUp(std::size_t i) {
+    T value = std::move(heap_[i]);
+    while (i > 0) {
+        std::size_t parent = (i - 1) / Arity;
+        if (!comp_(heap_[parent], value))
+            break;
+        heap_[i] = std::move(heap_[parent]);
+        i = parent;
+    }
+    heap_[i] = std::move(value);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void PriorityQueue<T, Compare, Arity>::siftDown(std::size_t i) {
+    const std::size_t n = heap_.size();
+    T value = std::move(heap_[i]);
+    for (;;) {
+        std::size_t first = i * Arity + 1;
+        if (first >= n)
+            break;
+        std::size_t last = first + Arity < n ? first + Arity : n;
+        std::size_t best = first;
+        for (std::size_t c = first + 1; c < last; ++c)
+            if (comp_(heap_[best], heap_[c]))
+                best = c;
+        if (!comp_(value, heap_[best]))
+            break;
+        heap_[i] = std::move(heap_[best]);
+        i = best;
+    }
+    heap_[i] = std::move(value);
+}
+
+/**
+ * @class IndexedPriorityQueue
+ * @brief A d-ary heap whose elements can be changed or removed by handle.
+ *
+ * push() returns a stable handle that stays valid until the element is popped
+ * or erased; handles of removed elements are recycled. The heap itself stores
+ * only handles, so moving entries around never moves the values.
+ *
+ * @tparam T Type of elements.
+ * @tparam Compare Strict weak ordering; std::less<T> yields a max-heap.
+ * @tparam Arity Number of children per node (at least 2).
+ */
+template<typename T, typename Compare = std::less<T>, std::size_t Arity = 2>
+class IndexedPriorityQueue {
+    static_assert(Arity >= 2, "IndexedPriorityQueue arity must be at least 2");
+public:
+    /// Opaque identifier of a queued element.
+    using handle = std::size_t;
+
+    /// Constructs an empty priority queue.
+    explicit IndexedPriorityQueue(const Compare& comp = Compare()) : comp_(comp) {}
+
+    /**
+     * @brief Inserts an element.
+     * @param value Element to insert.
+     * @return Handle identifying the element.
+     */
+    handle push(const T& value);
+
+    /**
+     * @brief Removes the top element.
+     * @throws std::out_of_range if the queue is empty.
+     */
+    void pop();
+
+    /**
+     * @brief Returns the top element.
+     * @throws std::out_of_range if the queue is empty.
+     */
+    const T& top() const;
+
+    /**
+     * @brief Returns the handle of the top element.
+     * @throws std::out_of_range if the queue is empty.
+     */
+    handle top_handle() const;
+
+    /// Checks whether @p h refers to an element currently in the queue.
+    bool contains(handle h) const;
+
+    /**
+     * @brief Returns the element identified by @p h.
+     * @throws std::out_of_range if @p h is not in the queue.
+     */
+    const T& get(handle h) const;
+
+    /**
+     * @brief Replaces the element identified by @p h with one that ranks at
+     *        least as high, moving it towards the top.
+     *
+     * With std::greater<T> (a min-queue) this is the classic decrease-key.
+     *
+     * @throws std::out_of_range if @p h is not in the queue.
+     * @throws std::invalid_argument if @p value ranks lower than the current element.
+     */
+    void decrease_key(handle h, const T& value);
+
+    /**
+     * @brief Replaces the element identified by @p h, moving it either way.
+     * @throws std::out_of_range if @p h is not in the queue.
+     */
+    void update(handle h, const T& value);
+
+    /**
+     * @brief Removes the element identified by @p h.
+     * @throws std::out_of_range if @p h is not in the queue.
+     */
+    void erase(handle h);
+
+    /// Checks if the queue is empty.
+    bool empty() const { return heap_.empty(); }
+
+    /// Returns the number of elements in the queue.
+    std::size_t size() const { return heap_.size(); }
+
+private:
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    DynamicArray<handle> heap_;        ///< Handles in d-ary heap order.
+    DynamicArray<T> values_;           ///< Element for each handle.
+    DynamicArray<std::size_t> pos_;    ///< Heap index for each handle, or npos.
+    DynamicArray<handle> freeHandles_; ///< Handles available for reuse.
+    Compare comp_;                     ///< Ordering; the greatest element is on top.
+
+    /// Compares the elements stored at two heap indices.
+    bool less(std::size_t a, std::size_t b) const { return comp_(values_[heap_[a]], values_[heap_[b]]); }
+    /// Places handle h at heap index i and records its position.
+    void place(std::size_t i, handle h) { heap_[i] = h; pos_[h] = i; }
+    /// Throws unless h is in the queue.
+    void check(handle h) const;
+    /// Removes the entry at heap index i.
+    void removeAt(std::size_t i);
+    /// Moves the entry at heap index i up until its parent is not smaller.
+    void siftUp(std::size_t i);
+    /// Moves the entry at heap index i down until no child is greater.
+    void siftDown(std::size_t i);
+};
+
+template<typename T, typename Compare, std::size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::handle
+IndexedPriorityQueue<T, Compare, Arity>::push(const T& value) {
+    handle h;
+    if (!freeHandles_.empty()) {
+        h = freeHandles_[freeHandles_.size() - 1];
+        freeHandles_.pop_back();
+        values_[h] = value;
+    } else {
+        h = values_.size();
+        values_.push_back(value);
+        pos_.push_back(npos);
+    }
+    heap_.push_back(h);
+    pos_[h] = heap_.size() - 1;
+    siftUp(heap_.size() - 1);
+    return h;
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::pop() {
+    if (heap_.empty())
+        throw std::out_of_range("PriorityQueue is empty");
+    removeAt(0);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+const T& IndexedPriorityQueue<T, Compare, Arity>::top() const {
+    return values_[top_handle()];
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+typename IndexedPriorityQueue<T, Compare, Arity>::handle
+IndexedPriorityQueue<T, Compare, Arity>::top_handle() const {
+    if (heap_.empty())
+        throw std::out_of_range("PriorityQueue is empty");
+    return heap_[0];
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+bool IndexedPriorityQueue<T, Compare, Arity>::contains(handle h) const {
+    return h < pos_.size() && pos_[h] != npos;
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::check(handle h) const {
+    if (!contains(h))
+        throw std::out_of_range("Invalid priority queue handle");
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+const T& IndexedPriorityQueue<T, Compare, Arity>::get(handle h) const {
+    check(h);
+    return values_[h];
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::decrease_key(handle h, const T& value) {
+    check(h);
+    if (comp_(value, values_[h]))
+        throw std::invalid_argument("decrease_key would move the element away from the top");
+    values_[h] = value;
+    siftUp(pos_[h]);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::update(handle h, const T& value) {
+    check(h);
+    bool up = comp_(values_[h], value);
+    values_[h] = value;
+    if (up)
+        siftUp(pos_[h]);
+    else
+        siftDown(pos_[h]);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::erase(handle h) {
+    check(h);
+    removeAt(pos_[h]);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::removeAt(std::size_t i) {
+    handle removed = heap_[i];
+    std::size_t last = heap_.size() - 1;
+    if (i != last) {
+        place(i, heap_[last]);
+        heap_.pop_back();
+        // The moved entry may belong above or below its new slot.
+        if (i > 0 && less((i - 1) / Arity, i))
+            siftUp(i);
+        else
+            siftDown(i);
+    } else {
+        heap_.pop_back();
+    }
+    pos_[removed] = npos;
+    freeHandles_.push_back(removed);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::siftUp(std::size_t i) {
+    handle h = heap_[i];
+    while (i > 0) {
+        std::size_t parent = (i - 1) / Arity;
+        if (!comp_(values_[heap_[parent]], values_[h]))
+            break;
+        place(i, heap_[parent]);
+        i = parent;
+    }
+    place(i, h);
+}
+
+template<typename T, typename Compare, std::size_t Arity>
+void IndexedPriorityQueue<T, Compare, Arity>::siftDown(std::size_t i) {
+    const std::size_t n = heap_.size();
+    handle h = heap_[i];
+    for (;;) {
+        std::size_t first = i * Arity + 1;
+        if (first >= n)
+            break;
+        std::size_t last = first + Arity < n ? first + Arity : n;
+        std::size_t best = first;
+        for (std::size_t c = first + 1; c < last; ++c)
+            if (less(best, c))
+                best = c;
+        if (!comp_(values_[h], values_[heap_[best]]))
+            break;
+        place(i, heap_[best]);
+        i = best;
+    }
+    place(i, h);
+}
+
+} // namespace dsa
+
+#endif // DSA_PRIORITYQUEUE_HPP
@@ -34,12 +34,33 @@
      /// Enqueues an element (using move semantics).
      void enqueue(T&& value) { container_.push_back(std::move(value)); }
  
+     /**
+      * @brief Enqueues every element of [first, last) in order.
+      * @param first Iterator to the first element.
+      * @param last Iterator past the last element.
+      */
+     template<typename InputIt>
+     void enqueue_range(InputIt first, InputIt last) { container_.push_back_range(first, last); }
+
      /// Dequeues an element.
      void dequeue() {
          if (container_.empty())
              throw std::out_of_range("Queue is empty");
          container_.pop_front();
      }
+
+     /**
+      * @brief Dequeues up to n elements, moving them to out in FIFO order.
+      *
+      * Unlike dequeue(), an empty queue is not an error; fewer elements
+      * (possibly none) are returned instead.
+      *
+      * @param out Output iterator receiving the elements.
+      * @param n Maximum number of elements to dequeue.
+      * @return Number of elements dequeued.
+      */
+     template<typename OutputIt>
+     std::size_t dequeue_n(OutputIt out, std::size_t n) { return container_.pop_front_n(out, n); }
  
      /**
       * @brief Returns the front element.
@@ -67,6 +88,9 @@
      /// Returns the number of elements in the queue.
      std::size_t size() const { return container_.size(); }
  
+     /// Releases container memory the current elements do not need.
+     void shrink_to_fit() { container_.shrink_to_fit(); }
+ 
  private:
      Container container_; ///< Underlying container.
  };
@@ -0,0 +1,379 @@
+/**
+ * @file RobinHoodTable.hpp
+ * @brief Declares the RobinHood layout: linear probing with Robin Hood displacement.
+ *
+ * Entries live in one array of slots, and a parallel byte array records how
+ * far each entry sits from its home slot. An insertion that meets an entry
+ * closer to its home than the new one takes that slot and carries the
+ * displaced entry onward ("robbing the rich"), which keeps probe lengths
+ * short and nearly uniform even at a load factor of 0.9. Because runs stay
+ * sorted by home slot, a lookup stops as soon as it meets an entry closer to
+ * its home than the key would be, and remove() shifts the rest of the run
+ * back by one slot instead of leaving a tombstone.
+ *
+ * @section Complexity
+ * - put/get/remove: O(1) expected at a load factor of at most 0.9
+ */
+
+#ifndef DSA_ROBINHOODTABLE_HPP
+#define DSA_ROBINHOODTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include "HashLayout.hpp"
+
+namespace dsa {
+
+/**
+ * @struct RobinHood
+ * @brief Layout storing entries in a flat Robin Hood hash table.
+ */
+struct RobinHood {
+    /**
+     * @class Table
+     * @brief Robin Hood table with backward-shift deletion.
+     *
+     * The capacity is a power of two; the table doubles once more than
+     * maxLoadFactor() (0.9 by default) of the slots would be full, or when
+     * an entry would end up 255 slots from home while at least a quarter of
+     * the slots are full. Below that load only keys sharing one hash form
+     * such runs, and more room would not help, so the insertion throws
+     * std::length_error and leaves the table unchanged.
+     */
+    template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+    class Table {
+    public:
+        /// Constructs a table able to hold @p capacity entries without growing.
+        explicit Table(std::size_t capacity);
+        /// Copy constructor.
+        Table(const Table& other);
+        /// Move constructor; leaves @p other empty.
+        Table(Table&& other) noexcept;
+        /// Copy and move assignment.
+        Table& operator=(Table other) noexcept;
+        /// Destructor.
+        ~Table();
+
+        /**
+         * Inserts @p key with a value built from @p args unless it is present.
+         * Returns the key's value and whether it was inserted.
+         */
+        template<typename... Args>
+        std::pair<Value*, bool> tryEmplace(const Key& key, Args&&... args);
+        /// Returns the value of @p key, or nullptr if absent.
+        template<typename K>
+        Value* find(const K& key);
+        /// Removes @p key if present.
+        void remove(const Key& key);
+        /// Returns the number of entries.
+        std::size_t size() const { return size_; }
+        /// Returns the number of slots.
+        std::size_t bucketCount() const { return capacity_; }
+        /// Calls @p fn(key, value) for every entry, in no particular order.
+        template<typename F>
+        void forEach(F& fn) const;
+
+        /// Grows the table so that @p count entries fit without growing again.
+        void reserve(std::size_t count);
+        /// Returns the load factor above which the table grows.
+        float maxLoadFactor() const { return maxLoad_; }
+        /**
+         * Sets the load factor above which the table grows, capped at 0.9;
+         * grows at once if already above it.
+         * @throws std::invalid_argument unless @p factor > 0.
+         */
+        void maxLoadFactor(float factor);
+
+    private:
+        using Slot = std::pair<Key, Value>;
+
+        /// Smallest capacity allocated.
+        static constexpr std::size_t minCapacity = 8;
+        /// Distance bytes are 1 + the distance from home, so this one never occurs.
+        static constexpr std::uint8_t distanceLimit = 255;
+
+        std::uint8_t* dist_;   ///< Per slot: 0 if empty, else 1 + distance from its home slot.
+        Slot* slots_;          ///< capacity_ slots, constructed where dist_ is non-zero.
+        std::size_t capacity_; ///< Number of slots; a power of two, or 0 before the first put.
+        std::size_t size_;     ///< Number of entries.
+        float maxLoad_;        ///< Load factor above which the table grows.
+        std::size_t growAt_;   ///< Entries that fit before growing: capacity_ * maxLoad_.
+
+        /// Highest load factor allowed.
+        static constexpr float maxLoadLimit = 0.9f;
+
+        template<typename K>
+        static std::size_t hashOf(const K& key) {
+            return static_cast<std::size_t>(detail::mixHash(Hash{}(key)));
+        }
+        /// Slot where the probe for hash @p h starts.
+        std::size_t home(std::size_t h) const { return h & (capacity_ - 1); }
+
+        /// Returns the slot holding @p key, or capacity_ if absent.
+        template<typename K>
+        std::size_t slotOf(const K& key, std::size_t h) const;
+        /**
+         * Places an entry known to be absent, displacing richer entries.
+         * Returns its slot, or capacity_ if the table grew meanwhile. Throws
+         * std::length_error if its probe is too long at low load, unless
+         * @p rehashing, when the entries are known to fit a larger table.
+         */
+        std::size_t insertNew(Slot slot, std::size_t h, bool rehashing = false);
+        /// Empties slot i and shifts the rest of its run back by one.
+        void eraseAt(std::size_t i);
+        /// Smallest capacity holding @p count entries within maxLoad_.
+        std::size_t slotsFor(std::size_t count) const;
+        /// Moves every entry into a table of @p capacity slots.
+        void resize(std::size_t capacity);
+        /// Allocates empty arrays of @p capacity slots into dist_ and slots_.
+        void allocate(std::size_t capacity);
+        /// Destroys all entries and frees the arrays.
+        void release();
+    };
+};
+
+template<typename Key, typename Value, typename Hash>
+RobinHood::Table<Key, Value, Hash>::Table(std::size_t capacity)
+    : dist_(nullptr), slots_(nullptr), capacity_(0), size_(0), maxLoad_(maxLoadLimit), growAt_(0) {
+    if (capacity == 0)
+        return;
+    allocate(slotsFor(capacity));
+}
+
+template<typename Key, typename Value, typename Hash>
+RobinHood::Table<Key, Value, Hash>::Table(const Table& other)
+    : dist_(nullptr), slots_(nullptr), capacity_(0), size_(0), maxLoad_(other.maxLoad_), growAt_(0) {
+    if (other.capacity_ == 0)
+        return;
+    allocate(other.capacity_);
+    try {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            if (other.dist_[i]) {
+                new (slots_ + i) Slot(other.slots_[i]);
+                dist_[i] = other.dist_[i];
+                ++size_;
+            }
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+RobinHood::Table<Key, Value, Hash>::Table(Table&& other) noexcept
+    : dist_(other.dist_), slots_(other.slots_), capacity_(other.capacity_), size_(other.size_),
+      maxLoad_(other.maxLoad_), growAt_(other.growAt_) {
+    other.dist_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.growAt_ = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+RobinHood::Table<Key, Value, Hash>& RobinHood::Table<Key, Value, Hash>::operator=(Table other) noexcept {
+    std::swap(dist_, other.dist_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(maxLoad_, other.maxLoad_);
+    std::swap(growAt_, other.growAt_);
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash>
+RobinHood::Table<Key, Value, Hash>::~Table() {
+    release();
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::allocate(std::size_t capacity) {
+    std::uint8_t* dist = new std::uint8_t[capacity];
+    try {
+        slots_ = std::allocator<Slot>().allocate(capacity);
+    } catch (...) {
+        delete[] dist;
+        throw;
+    }
+    std::memset(dist, 0, capacity);
+    dist_ = dist;
+    capacity_ = capacity;
+    growAt_ = static_cast<std::size_t>(capacity * static_cast<double>(maxLoad_));
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::release() {
+    if (!dist_)
+        return;
+    for (std::size_t i = 0; i < capacity_; ++i)
+        if (dist_[i])
+            slots_[i].~Slot();
+    std::allocator<Slot>().deallocate(slots_, capacity_);
+    delete[] dist_;
+    dist_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growAt_ = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename K>
+std::size_t RobinHood::Table<Key, Value, Hash>::slotOf(const K& key, std::size_t h) const {
+    const std::size_t mask = capacity_ - 1;
+    std::size_t i = home(h);
+    // Past a slot whose entry is closer to home than we are, the key cannot be.
+    for (std::uint8_t d = 1; dist_[i] >= d; ++d, i = (i + 1) & mask) {
+        if (dist_[i] == d && slots_[i].first == key)
+            return i;
+    }
+    return capacity_;
+}
+
+template<typename Key, typename Value, typename Hash>
+std::size_t RobinHood::Table<Key, Value, Hash>::insertNew(Slot slot, std::size_t h, bool rehashing) {
+    const std::size_t mask = capacity_ - 1;
+    // Trace the displacement pass on the distance bytes alone, so a probe
+    // that would reach the limit is caught before any entry moves.
+    std::uint8_t d = 1;
+    for (std::size_t i = home(h); dist_[i]; i = (i + 1) & mask) {
+        if (dist_[i] < d)
+            d = dist_[i];
+        if (++d == distanceLimit) {
+            if (!rehashing && size_ < capacity_ / 4)
+                throw std::length_error("RobinHood table: too many keys share one hash");
+            resize(capacity_ * 2);
+            insertNew(std::move(slot), h, rehashing);
+            return capacity_;
+        }
+    }
+    std::size_t i = home(h);
+    std::size_t placed = capacity_;
+    d = 1;
+    while (dist_[i]) {
+        if (dist_[i] < d) {
+            std::swap(slot, slots_[i]);
+            std::swap(d, dist_[i]);
+            if (placed == capacity_)
+                placed = i;
+        }
+        i = (i + 1) & mask;
+        ++d;
+    }
+    new (slots_ + i) Slot(std::move(slot));
+    dist_[i] = d;
+    ++size_;
+    return placed == capacity_ ? i : placed;
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename... Args>
+std::pair<Value*, bool> RobinHood::Table<Key, Value, Hash>::tryEmplace(const Key& key, Args&&... args) {
+    const std::size_t h = hashOf(key);
+    if (capacity_) {
+        std::size_t i = slotOf(key, h);
+        if (i != capacity_)
+            return {&slots_[i].second, false};
+    }
+    if (size_ >= growAt_)
+        resize(slotsFor(size_ + 1));
+    std::size_t i = insertNew(Slot(std::piecewise_construct, std::forward_as_tuple(key),
+                                   std::forward_as_tuple(std::forward<Args>(args)...)), h);
+    if (i == capacity_)
+        i = slotOf(key, h);
+    return {&slots_[i].second, true};
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename K>
+Value* RobinHood::Table<Key, Value, Hash>::find(const K& key) {
+    if (!capacity_)
+        return nullptr;
+    std::size_t i = slotOf(key, hashOf(key));
+    return i == capacity_ ? nullptr : &slots_[i].second;
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename F>
+void RobinHood::Table<Key, Value, Hash>::forEach(F& fn) const {
+    for (std::size_t i = 0; i < capacity_; ++i)
+        if (dist_[i])
+            fn(slots_[i].first, slots_[i].second);
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::remove(const Key& key) {
+    if (!capacity_)
+        return;
+    std::size_t i = slotOf(key, hashOf(key));
+    if (i != capacity_)
+        eraseAt(i);
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::eraseAt(std::size_t i) {
+    const std::size_t mask = capacity_ - 1;
+    slots_[i].~Slot();
+    --size_;
+    // Entries after the hole move one slot closer to home until the run ends
+    // or an entry already sits at home.
+    for (std::size_t j = (i + 1) & mask; dist_[j] > 1; i = j, j = (j + 1) & mask) {
+        new (slots_ + i) Slot(std::move(slots_[j]));
+        slots_[j].~Slot();
+        dist_[i] = static_cast<std::uint8_t>(dist_[j] - 1);
+    }
+    dist_[i] = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+std::size_t RobinHood::Table<Key, Value, Hash>::slotsFor(std::size_t count) const {
+    std::size_t slots = minCapacity;
+    while (static_cast<std::size_t>(slots * static_cast<double>(maxLoad_)) < count)
+        slots *= 2;
+    return slots;
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::reserve(std::size_t count) {
+    std::size_t slots = slotsFor(count);
+    if (slots > capacity_)
+        resize(slots);
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::maxLoadFactor(float factor) {
+    if (!(factor > 0.0f))
+        throw std::invalid_argument("max load factor must be positive");
+    maxLoad_ = factor < maxLoadLimit ? factor : maxLoadLimit;
+    if (capacity_) {
+        growAt_ = static_cast<std::size_t>(capacity_ * static_cast<double>(maxLoad_));
+        if (size_ > growAt_)
+            resize(slotsFor(size_));
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+void RobinHood::Table<Key, Value, Hash>::resize(std::size_t capacity) {
+    Table grown(0);
+    grown.maxLoad_ = maxLoad_;
+    grown.allocate(capacity);
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        if (dist_[i]) {
+            std::size_t h = hashOf(slots_[i].first);
+            grown.insertNew(std::move(slots_[i]), h, true);
+        }
+    }
+    *this = std::move(grown);
+}
+
+} // namespace dsa
+
+#endif // DSA_ROBINHOODTABLE_HPP
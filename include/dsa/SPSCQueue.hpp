@@ -0,0 +1,246 @@
+/**
+ * @file SPSCQueue.hpp
+ * @brief Defines a bounded single-producer/single-consumer lock-free ring buffer.
+ *
+ * The queue is intended for handing items between exactly two threads, e.g.
+ * adjacent stages of a pipeline. One thread may only push and the other may
+ * only pop; no locks are taken on either side.
+ *
+ * @section Complexity
+ * - try_push/try_pop: O(1), wait-free
+ * - push_n/pop_n: O(k) for k transferred elements, one index publish per batch
+ * - size/empty: O(1) (a snapshot; may be stale under concurrent use)
+ *
+ * @section Example
+ * @code
+ * dsa::SPSCQueue<int> queue(1024);
+ * // producer thread
+ * queue.try_push(42);
+ * // consumer thread
+ * int x;
+ * if (queue.try_pop(x)) { ... }
+ * @endcode
+ */
+
+#ifndef DSA_SPSCQUEUE_HPP
+#define DSA_SPSCQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include "Utilities.hpp"
+
+namespace dsa {
+
+/**
+ * @class SPSCQueue
+ * @brief A bounded lock-free ring buffer for one producer and one consumer.
+ *
+ * Indices grow monotonically and are mapped into the buffer with a mask, so
+ * the capacity is always rounded up to a power of two. The producer-owned and
+ * consumer-owned indices live on separate cache lines, and each side keeps a
+ * private copy of the other side's index so that it only touches the shared
+ * line when its cached view says the ring is full (or empty).
+ *
+ * @tparam T Type of elements. Must be default constructible and assignable.
+ *
+ * @section Thread Safety
+ * Safe for exactly one thread calling the push functions and one thread
+ * calling the pop functions concurrently. size() and empty() may be called
+ * from either side.
+ */
+template<typename T>
+class SPSCQueue {
+public:
+    /**
+     * @brief Constructs a queue able to hold at least @p capacity elements.
+     *
+     * @param capacity Minimum number of elements; rounded up to a power of two.
+     * @throws std::invalid_argument if capacity is zero.
+     */
+    explicit SPSCQueue(std::size_t capacity);
+
+    /// Destructor.
+    ~SPSCQueue();
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /**
+     * @brief Attempts to append an element (producer only).
+     * @param value Element to be added.
+     * @return True on success, false if the queue is full.
+     */
+    bool try_push(const T& value);
+
+    /**
+     * @brief Attempts to append an element using move semantics (producer only).
+     * @param value Element to be added.
+     * @return True on success, false if the queue is full.
+     */
+    bool try_push(T&& value);
+
+    /**
+     * @brief Appends up to @p count elements from @p items (producer only).
+     *
+     * The consumer observes the whole batch with a single index update.
+     *
+     * @param items Pointer to the first element to copy.
+     * @param count Number of elements available at @p items.
+     * @return Number of elements actually pushed.
+     */
+    std::size_t push_n(const T* items, std::size_t count);
+
+    /**
+     * @brief Attempts to remove the oldest element (consumer only).
+     * @param out Receives the removed element.
+     * @return True on success, false if the queue is empty.
+     */
+    bool try_pop(T& out);
+
+    /**
+     * @brief Removes up to @p max elements into @p out (consumer only).
+     * @param out Destination buffer with room for at least @p max elements.
+     * @param max Maximum number of elements to remove.
+     * @return Number of elements actually removed.
+     */
+    std::size_t pop_n(T* out, std::size_t max);
+
+    /// Returns true if the queue appeared empty at the time of the call.
+    bool empty() const;
+
+    /// Returns the number of elements at the time of the call.
+    std::size_t size() const;
+
+    /// Returns the maximum number of elements the queue can hold.
+    std::size_t capacity() const { return mask_ + 1; }
+
+private:
+    /// Rounds @p n up to the next power of two.
+    static std::size_t roundUpPow2(std::size_t n);
+
+    /// Shared implementation of the try_push overloads.
+    template<typename U>
+    bool pushOne(U&& value);
+
+    // Read-only after construction.
+    alignas(cacheLineSize) T* buffer_;  ///< Ring storage.
+    std::size_t mask_;                  ///< capacity() - 1.
+
+    // Written by the consumer.
+    alignas(cacheLineSize) std::atomic<std::size_t> head_; ///< Next slot to pop.
+    std::size_t cachedTail_;            ///< Consumer's view of tail_.
+
+    // Written by the producer.
+    alignas(cacheLineSize) std::atomic<std::size_t> tail_; ///< Next slot to push.
+    std::size_t cachedHead_;            ///< Producer's view of head_.
+};
+
+template<typename T>
+std::size_t SPSCQueue<T>::roundUpPow2(std::size_t n) {
+    std::size_t p = 1;
+    while (p < n)
+        p <<= 1;
+    return p;
+}
+
+template<typename T>
+SPSCQueue<T>::SPSCQueue(std::size_t capacity)
+    : buffer_(nullptr), mask_(0), head_(0), cachedTail_(0), tail_(0), cachedHead_(0) {
+    if (capacity == 0)
+        throw std::invalid_argument("SPSCQueue capacity must be positive");
+    std::size_t cap = roundUpPow2(capacity);
+    buffer_ = new T[cap];
+    mask_ = cap - 1;
+}
+
+template<typename T>
+SPSCQueue<T>::~SPSCQueue() {
+    delete[] buffer_;
+}
+
+template<typename T>
+bool SPSCQueue<T>::try_push(const T& value) {
+    return pushOne(value);
+}
+
+template<typename T>
+bool SPSCQueue<T>::try_push(T&& value) {
+    return pushOne(std::move(value));
+}
+
+template<typename T>
+template<typename U>
+bool SPSCQueue<T>::pushOne(U&& value) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - cachedHead_ > mask_) {
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        if (tail - cachedHead_ > mask_)
+            return false;
+    }
+    buffer_[tail & mask_] = std::forward<U>(value);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+std::size_t SPSCQueue<T>::push_n(const T* items, std::size_t count) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    std::size_t free = capacity() - (tail - cachedHead_);
+    if (free < count) {
+        cachedHead_ = head_.load(std::memory_order_acquire);
+        free = capacity() - (tail - cachedHead_);
+    }
+    const std::size_t n = count < free ? count : free;
+    for (std::size_t i = 0; i < n; ++i)
+        buffer_[(tail + i) & mask_] = items[i];
+    if (n)
+        tail_.store(tail + n, std::memory_order_release);
+    return n;
+}
+
+template<typename T>
+bool SPSCQueue<T>::try_pop(T& out) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if (head == cachedTail_) {
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        if (head == cachedTail_)
+            return false;
+    }
+    out = std::move(buffer_[head & mask_]);
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+std::size_t SPSCQueue<T>::pop_n(T* out, std::size_t max) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t available = cachedTail_ - head;
+    if (available < max) {
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        available = cachedTail_ - head;
+    }
+    const std::size_t n = max < available ? max : available;
+    for (std::size_t i = 0; i < n; ++i)
+        out[i] = std::move(buffer_[(head + i) & mask_]);
+    if (n)
+        head_.store(head + n, std::memory_order_release);
+    return n;
+}
+
+template<typename T>
+bool SPSCQueue<T>::empty() const {
+    return size() == 0;
+}
+
+template<typename T>
+std::size_t SPSCQueue<T>::size() const {
+    const std::size_t head = head_.load(std::memory_order_acquire);
+    const std::size_t tail = tail_.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+} // namespace dsa
+
+#endif // DSA_SPSCQUEUE_HPP
@@ -34,12 +34,33 @@
      /// Pushes an element (using move semantics) onto the stack.
      void push(T&& value) { container_.push_front(std::move(value)); }
  
+     /**
+      * @brief Pushes every element of [first, last); the last one ends on top.
+      * @param first Iterator to the first element.
+      * @param last Iterator past the last element.
+      */
+     template<typename InputIt>
+     void push_range(InputIt first, InputIt last) { container_.push_front_range(first, last); }
+
      /// Removes the top element.
      void pop() {
          if (container_.empty())
              throw std::out_of_range("Stack is empty");
          container_.pop_front();
      }
+
+     /**
+      * @brief Pops up to n elements, moving them to out from the top down.
+      *
+      * Unlike pop(), an empty stack is not an error; fewer elements
+      * (possibly none) are returned instead.
+      *
+      * @param out Output iterator receiving the elements.
+      * @param n Maximum number of elements to pop.
+      * @return Number of elements popped.
+      */
+     template<typename OutputIt>
+     std::size_t pop_n(OutputIt out, std::size_t n) { return container_.pop_front_n(out, n); }
  
      /**
       * @brief Returns the top element.
@@ -67,6 +88,9 @@
      /// Returns the number of elements in the stack.
      std::size_t size() const { return container_.size(); }
  
+     /// Releases container memory the current elements do not need.
+     void shrink_to_fit() { container_.shrink_to_fit(); }
+ 
  private:
      Container container_; ///< Underlying container.
  };
@@ -0,0 +1,464 @@
+/**
+ * @file SwissTable.hpp
+ * @brief Declares the SwissTable layout: flat open addressing with SIMD probing.
+ *
+ * Entries live in one array of slots, and a parallel array holds one control
+ * byte per slot: empty, or 7 bits of the entry's hash. A lookup loads a group
+ * of consecutive control bytes (32 with AVX2, 16 with SSE2, 8 otherwise) and
+ * compares them all with the key's 7 hash bits at once, so keys are only
+ * compared for slots that very probably hold them, and a probe ends at the
+ * first group containing an empty slot.
+ *
+ * Probing is linear, which lets remove() shift the following entries back
+ * instead of leaving tombstones: the table never fills up with deleted
+ * markers and lookups never slow down after many removals.
+ *
+ * @section Complexity
+ * - put/get/remove: O(1) expected at a load factor of at most 7/8
+ */
+
+#ifndef DSA_SWISSTABLE_HPP
+#define DSA_SWISSTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+#include "HashLayout.hpp"
+
+namespace dsa {
+
+namespace detail {
+
+/// Control byte of an empty slot; a full slot holds 7 hash bits (0..127).
+constexpr std::int8_t swissEmpty = -128;
+
+/**
+ * @struct SwissGroup
+ * @brief A window of consecutive control bytes compared in parallel.
+ *
+ * Results are bit masks in which slot i of the window is bit (i << shift).
+ */
+struct SwissGroup {
+#if defined(__AVX2__)
+    static constexpr std::size_t width = 32; ///< Control bytes per group.
+    static constexpr int shift = 0;          ///< log2 of mask bits per slot.
+
+    explicit SwissGroup(const std::int8_t* ctrl)
+        : bytes_(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ctrl))) {}
+
+    /// Slots whose control byte equals @p h2.
+    std::uint64_t match(std::int8_t h2) const {
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes_, _mm256_set1_epi8(h2))));
+    }
+    /// Empty slots; the only control bytes with the sign bit set.
+    std::uint64_t matchEmpty() const { return static_cast<std::uint32_t>(_mm256_movemask_epi8(bytes_)); }
+
+private:
+    __m256i bytes_;
+#elif defined(__SSE2__)
+    static constexpr std::size_t width = 16; ///< Control bytes per group.
+    static constexpr int shift = 0;          ///< log2 of mask bits per slot.
+
+    explicit SwissGroup(const std::int8_t* ctrl)
+        : bytes_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+    /// Slots whose control byte equals @p h2.
+    std::uint64_t match(std::int8_t h2) const {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes_, _mm_set1_epi8(h2))));
+    }
+    /// Empty slots; the only control bytes with the sign bit set.
+    std::uint64_t matchEmpty() const { return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes_)); }
+
+private:
+    __m128i bytes_;
+#else
+    static constexpr std::size_t width = 8; ///< Control bytes per group.
+    static constexpr int shift = 3;         ///< log2 of mask bits per slot.
+
+    explicit SwissGroup(const std::int8_t* ctrl) : bytes_(0) {
+        for (std::size_t i = 0; i < width; ++i)
+            bytes_ |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(ctrl[i])) << (8 * i);
+    }
+
+    /// Slots whose control byte equals @p h2, plus rare full false positives.
+    std::uint64_t match(std::int8_t h2) const {
+        std::uint64_t x = bytes_ ^ (lsbs * static_cast<std::uint8_t>(h2));
+        return (x - lsbs) & ~x & msbs;
+    }
+    /// Empty slots; the only control bytes with the sign bit set.
+    std::uint64_t matchEmpty() const { return bytes_ & msbs; }
+
+private:
+    static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+    static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+    std::uint64_t bytes_;
+#endif
+};
+
+/// Index of the lowest slot set in a non-empty SwissGroup mask.
+inline std::size_t lowestSlot(std::uint64_t mask) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(mask)) >> SwissGroup::shift;
+#else
+    std::size_t bit = 0;
+    while (!(mask & 1)) {
+        mask >>= 1;
+        ++bit;
+    }
+    return bit >> SwissGroup::shift;
+#endif
+}
+
+} // namespace detail
+
+/**
+ * @struct SwissTable
+ * @brief Layout storing entries in a flat, SIMD-probed open-addressing table.
+ */
+struct SwissTable {
+    /**
+     * @class Table
+     * @brief Swiss table with linear group probing and backward-shift deletion.
+     *
+     * The capacity is a power of two no smaller than a group; the table
+     * doubles once more than maxLoadFactor() (7/8 by default) of the slots
+     * would be full.
+     */
+    template<typename Key, typename Value, typename Hash = DefaultHash<Key>>
+    class Table {
+    public:
+        /// Constructs a table able to hold @p capacity entries without growing.
+        explicit Table(std::size_t capacity);
+        /// Copy constructor.
+        Table(const Table& other);
+        /// Move constructor; leaves @p other empty.
+        Table(Table&& other) noexcept;
+        /// Copy and move assignment.
+        Table& operator=(Table other) noexcept;
+        /// Destructor.
+        ~Table();
+
+        /**
+         * Inserts @p key with a value built from @p args unless it is present.
+         * Returns the key's value and whether it was inserted.
+         */
+        template<typename... Args>
+        std::pair<Value*, bool> tryEmplace(const Key& key, Args&&... args);
+        /// Returns the value of @p key, or nullptr if absent.
+        template<typename K>
+        Value* find(const K& key);
+        /// Removes @p key if present.
+        void remove(const Key& key);
+        /// Returns the number of entries.
+        std::size_t size() const { return size_; }
+        /// Returns the number of slots.
+        std::size_t bucketCount() const { return capacity_; }
+        /// Calls @p fn(key, value) for every entry, in no particular order.
+        template<typename F>
+        void forEach(F& fn) const;
+
+        /// Grows the table so that @p count entries fit without growing again.
+        void reserve(std::size_t count);
+        /// Returns the load factor above which the table grows.
+        float maxLoadFactor() const { return maxLoad_; }
+        /**
+         * Sets the load factor above which the table grows, capped at 7/8;
+         * grows at once if already above it.
+         * @throws std::invalid_argument unless @p factor > 0.
+         */
+        void maxLoadFactor(float factor);
+
+    private:
+        using Slot = std::pair<Key, Value>;
+        using Group = detail::SwissGroup;
+
+        std::int8_t* ctrl_;    ///< capacity_ control bytes, then copies of the first width - 1.
+        Slot* slots_;          ///< capacity_ slots, constructed where the control byte is full.
+        std::size_t capacity_; ///< Number of slots; a power of two, or 0 before the first put.
+        std::size_t size_;     ///< Number of entries.
+        float maxLoad_;        ///< Load factor above which the table grows.
+        std::size_t growAt_;   ///< Entries that fit before growing: capacity_ * maxLoad_.
+
+        /// Highest load factor allowed.
+        static constexpr float maxLoadLimit = 0.875f;
+
+        template<typename K>
+        static std::size_t hashOf(const K& key) {
+            return static_cast<std::size_t>(detail::mixHash(Hash{}(key)));
+        }
+        /// Slot where the probe for hash @p h starts.
+        std::size_t home(std::size_t h) const { return (h >> 7) & (capacity_ - 1); }
+        /// Control byte stored for hash @p h.
+        static std::int8_t h2(std::size_t h) { return static_cast<std::int8_t>(h & 0x7F); }
+
+        /// Sets a control byte and its copy past the end, if it has one.
+        void setCtrl(std::size_t i, std::int8_t c) {
+            ctrl_[i] = c;
+            if (i < Group::width - 1)
+                ctrl_[capacity_ + i] = c;
+        }
+
+        /**
+         * Returns the slot holding @p key, or capacity_ if absent; then
+         * @p empty is the first empty slot of the probe, where it belongs.
+         */
+        template<typename K>
+        std::size_t probe(const K& key, std::size_t h, std::size_t& empty) const;
+        /// First empty slot on the probe sequence of hash @p h.
+        std::size_t firstEmpty(std::size_t h) const;
+        /// Empties slot i, shifting later entries of its run back into the hole.
+        void eraseAt(std::size_t i);
+        /// Smallest capacity holding @p count entries within maxLoad_.
+        std::size_t slotsFor(std::size_t count) const;
+        /// Moves every entry into a table of @p capacity slots.
+        void resize(std::size_t capacity);
+        /// Allocates empty arrays of @p capacity slots into ctrl_ and slots_.
+        void allocate(std::size_t capacity);
+        /// Destroys all entries and frees the arrays.
+        void release();
+    };
+};
+
+template<typename Key, typename Value, typename Hash>
+SwissTable::Table<Key, Value, Hash>::Table(std::size_t capacity)
+    : ctrl_(nullptr), slots_(nullptr), capacity_(0), size_(0), maxLoad_(maxLoadLimit), growAt_(0) {
+    if (capacity == 0)
+        return;
+    allocate(slotsFor(capacity));
+}
+
+template<typename Key, typename Value, typename Hash>
+SwissTable::Table<Key, Value, Hash>::Table(const Table& other)
+    : ctrl_(nullptr), slots_(nullptr), capacity_(0), size_(0), maxLoad_(other.maxLoad_), growAt_(0) {
+    if (other.capacity_ == 0)
+        return;
+    allocate(other.capacity_);
+    std::size_t i = 0;
+    try {
+        for (; i < capacity_; ++i) {
+            if (other.ctrl_[i] != detail::swissEmpty) {
+                new (slots_ + i) Slot(other.slots_[i]);
+                setCtrl(i, other.ctrl_[i]);
+                ++size_;
+            }
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+SwissTable::Table<Key, Value, Hash>::Table(Table&& other) noexcept
+    : ctrl_(other.ctrl_), slots_(other.slots_), capacity_(other.capacity_), size_(other.size_),
+      maxLoad_(other.maxLoad_), growAt_(other.growAt_) {
+    other.ctrl_ = nullptr;
+    other.slots_ = nullptr;
+    other.capacity_ = 0;
+    other.size_ = 0;
+    other.growAt_ = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+SwissTable::Table<Key, Value, Hash>& SwissTable::Table<Key, Value, Hash>::operator=(Table other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(maxLoad_, other.maxLoad_);
+    std::swap(growAt_, other.growAt_);
+    return *this;
+}
+
+template<typename Key, typename Value, typename Hash>
+SwissTable::Table<Key, Value, Hash>::~Table() {
+    release();
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::allocate(std::size_t capacity) {
+    std::int8_t* ctrl = new std::int8_t[capacity + Group::width - 1];
+    try {
+        slots_ = std::allocator<Slot>().allocate(capacity);
+    } catch (...) {
+        delete[] ctrl;
+        throw;
+    }
+    std::memset(ctrl, static_cast<unsigned char>(detail::swissEmpty), capacity + Group::width - 1);
+    ctrl_ = ctrl;
+    capacity_ = capacity;
+    growAt_ = static_cast<std::size_t>(capacity * static_cast<double>(maxLoad_));
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::release() {
+    if (!ctrl_)
+        return;
+    for (std::size_t i = 0; i < capacity_; ++i)
+        if (ctrl_[i] != detail::swissEmpty)
+            slots_[i].~Slot();
+    std::allocator<Slot>().deallocate(slots_, capacity_);
+    delete[] ctrl_;
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = 0;
+    size_ = 0;
+    growAt_ = 0;
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename K>
+std::size_t SwissTable::Table<Key, Value, Hash>::probe(const K& key, std::size_t h, std::size_t& empty) const {
+    const std::size_t mask = capacity_ - 1;
+    const std::int8_t tag = h2(h);
+    for (std::size_t pos = home(h);; pos = (pos + Group::width) & mask) {
+        Group group(ctrl_ + pos);
+        for (std::uint64_t m = group.match(tag); m; m &= m - 1) {
+            std::size_t i = (pos + detail::lowestSlot(m)) & mask;
+            if (slots_[i].first == key)
+                return i;
+        }
+        // Entries never sit past an empty slot of their probe sequence.
+        if (std::uint64_t e = group.matchEmpty()) {
+            empty = (pos + detail::lowestSlot(e)) & mask;
+            return capacity_;
+        }
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+std::size_t SwissTable::Table<Key, Value, Hash>::firstEmpty(std::size_t h) const {
+    const std::size_t mask = capacity_ - 1;
+    for (std::size_t pos = home(h);; pos = (pos + Group::width) & mask) {
+        if (std::uint64_t e = Group(ctrl_ + pos).matchEmpty())
+            return (pos + detail::lowestSlot(e)) & mask;
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename... Args>
+std::pair<Value*, bool> SwissTable::Table<Key, Value, Hash>::tryEmplace(const Key& key, Args&&... args) {
+    const std::size_t h = hashOf(key);
+    std::size_t empty = 0;
+    if (capacity_) {
+        std::size_t i = probe(key, h, empty);
+        if (i != capacity_)
+            return {&slots_[i].second, false};
+    }
+    if (size_ >= growAt_) {
+        resize(slotsFor(size_ + 1));
+        empty = firstEmpty(h);
+    }
+    new (slots_ + empty) Slot(std::piecewise_construct, std::forward_as_tuple(key),
+                              std::forward_as_tuple(std::forward<Args>(args)...));
+    setCtrl(empty, h2(h));
+    ++size_;
+    return {&slots_[empty].second, true};
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename K>
+Value* SwissTable::Table<Key, Value, Hash>::find(const K& key) {
+    if (!capacity_)
+        return nullptr;
+    std::size_t empty;
+    std::size_t i = probe(key, hashOf(key), empty);
+    return i == capacity_ ? nullptr : &slots_[i].second;
+}
+
+template<typename Key, typename Value, typename Hash>
+template<typename F>
+void SwissTable::Table<Key, Value, Hash>::forEach(F& fn) const {
+    for (std::size_t i = 0; i < capacity_; ++i)
+        if (ctrl_[i] != detail::swissEmpty)
+            fn(slots_[i].first, slots_[i].second);
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::remove(const Key& key) {
+    if (!capacity_)
+        return;
+    std::size_t empty;
+    std::size_t i = probe(key, hashOf(key), empty);
+    if (i != capacity_)
+        eraseAt(i);
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::eraseAt(std::size_t i) {
+    const std::size_t mask = capacity_ - 1;
+    slots_[i].~Slot();
+    --size_;
+    // Knuth's Algorithm R: an entry may fill the hole unless its home slot
+    // lies cyclically after the hole, which would put it before its home.
+    std::size_t hole = i;
+    for (std::size_t j = (i + 1) & mask; ctrl_[j] != detail::swissEmpty; j = (j + 1) & mask) {
+        std::size_t start = home(hashOf(slots_[j].first));
+        if (((j - start) & mask) >= ((j - hole) & mask)) {
+            new (slots_ + hole) Slot(std::move(slots_[j]));
+            slots_[j].~Slot();
+            setCtrl(hole, ctrl_[j]);
+            hole = j;
+        }
+    }
+    setCtrl(hole, detail::swissEmpty);
+}
+
+template<typename Key, typename Value, typename Hash>
+std::size_t SwissTable::Table<Key, Value, Hash>::slotsFor(std::size_t count) const {
+    std::size_t slots = Group::width;
+    while (static_cast<std::size_t>(slots * static_cast<double>(maxLoad_)) < count)
+        slots *= 2;
+    return slots;
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::reserve(std::size_t count) {
+    std::size_t slots = slotsFor(count);
+    if (slots > capacity_)
+        resize(slots);
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::maxLoadFactor(float factor) {
+    if (!(factor > 0.0f))
+        throw std::invalid_argument("max load factor must be positive");
+    maxLoad_ = factor < maxLoadLimit ? factor : maxLoadLimit;
+    if (capacity_) {
+        growAt_ = static_cast<std::size_t>(capacity_ * static_cast<double>(maxLoad_));
+        if (size_ > growAt_)
+            resize(slotsFor(size_));
+    }
+}
+
+template<typename Key, typename Value, typename Hash>
+void SwissTable::Table<Key, Value, Hash>::resize(std::size_t capacity) {
+    Table grown(0);
+    grown.maxLoad_ = maxLoad_;
+    grown.allocate(capacity);
+    for (std::size_t i = 0; i < capacity_; ++i) {
+        if (ctrl_[i] == detail::swissEmpty)
+            continue;
+        std::size_t h = hashOf(slots_[i].first);
+        std::size_t j = grown.firstEmpty(h);
+        new (grown.slots_ + j) Slot(std::move(slots_[i]));
+        grown.setCtrl(j, h2(h));
+        ++grown.size_;
+    }
+    *this = std::move(grown);
+}
+
+} // namespace dsa
+
+#endif // DSA_SWISSTABLE_HPP
@@ -1,16 +1,60 @@
 /**
  * @file Tree.hpp
  * @brief Declares a binary search tree (BST) with in-order traversal.
+ *
+ * The tree is unbalanced by default. Passing AVLBalance or RedBlackBalance
+ * (see TreeBalance.hpp) as the second template argument guarantees
+ * O(log n) insert, remove and search regardless of insertion order.
+ * TreapBalance instead lets every found element rise toward the root, which
+ * favors workloads that keep returning to a few hot keys.
+ *
+ * Every node also records the size of its subtree, which gives rank(),
+ * select() and count_range() in O(height) without walking the elements.
+ *
+ * from_sorted() builds a perfectly balanced tree in O(n) with one
+ * allocation per element; from_unsorted() sorts a copy first.
  */
 
  #ifndef DSA_TREE_HPP
  #define DSA_TREE_HPP
  
+ #include <algorithm>
+ #include <cstddef>
+ #include <functional>
+ #include <future>
  #include <iostream>
- #include <stack>
+ #include <iterator>
  #include <stdexcept>
+ #include <type_traits>
+ #include <utility>
+ #include <vector>
+ #include "TreeBalance.hpp"
+ #include "TreeNodeOps.hpp"
  
  namespace dsa {
+
+ namespace detail {
+
+ template<typename T>
+ struct TreeJoin;
+
+ /// Sorts [first, last) by splitting it across up to @p threads tasks and merging.
+ template<typename RandomIt>
+ void parallelSort(RandomIt first, RandomIt last, unsigned threads) {
+     const std::ptrdiff_t minParallel = 1 << 14;
+     if (threads <= 1 || last - first < minParallel) {
+         std::sort(first, last);
+         return;
+     }
+     RandomIt mid = first + (last - first) / 2;
+     unsigned half = threads / 2;
+     auto left = std::async(std::launch::async, [=] { parallelSort(first, mid, half); });
+     parallelSort(mid, last, threads - half);
+     left.get();
+     std::inplace_merge(first, mid, last);
+ }
+
+ } // namespace detail
  
  /**
   * @struct TreeNode
@@ -23,11 +67,15 @@
      T data;              ///< Data contained in the node.
      TreeNode* left;      ///< Pointer to left child.
      TreeNode* right;     ///< Pointer to right child.
+     TreeNode* parent;    ///< Pointer to parent (null for the root).
+     std::size_t size;    ///< Number of nodes in the subtree rooted here.
+     int tag;             ///< Balancing metadata owned by the tree's Balance policy.
      /**
       * @brief Constructs a tree node.
       * @param value Data value for the node.
       */
-     TreeNode(const T& value) : data(value), left(nullptr), right(nullptr) {}
+     TreeNode(const T& value)
+         : data(value), left(nullptr), right(nullptr), parent(nullptr), size(1), tag(0) {}
  };
  
  /**
@@ -35,10 +83,12 @@
   * @brief A basic binary search tree.
   *
   * Provides methods to insert, search, and traverse the BST in order.
+  * Elements are ordered with operator< only; duplicates are ignored.
   *
   * @tparam T Type of elements in the BST.
+  * @tparam Balance Balancing policy: NoBalance, AVLBalance or RedBlackBalance.
   */
- template<typename T>
+ template<typename T, typename Balance = NoBalance>
  class BinarySearchTree {
  public:
      /// Default constructor.
@@ -55,6 +105,32 @@
      BinarySearchTree& operator=(BinarySearchTree other);
      /// Destructor.
      ~BinarySearchTree();
+
+     /**
+      * @brief Builds a perfectly balanced tree from sorted input in O(n).
+      *
+      * Nodes are allocated once each, in order, and the Balance policy's
+      * metadata is filled in directly, so no rotations are performed.
+      * Equivalent adjacent elements are collapsed into one.
+      *
+      * @tparam ForwardIt Forward iterator; the range is traversed twice.
+      * @param first Beginning of a range sorted by operator<.
+      * @param last End of the range.
+      */
+     template<typename ForwardIt>
+     static BinarySearchTree from_sorted(ForwardIt first, ForwardIt last);
+
+     /**
+      * @brief Builds a perfectly balanced tree from unsorted input.
+      *
+      * Copies and sorts the input, then calls from_sorted(). O(n log n).
+      *
+      * @param first Beginning of the range.
+      * @param last End of the range.
+      * @param threads Number of tasks the sort may use; 1 sorts serially.
+      */
+     template<typename InputIt>
+     static BinarySearchTree from_unsorted(InputIt first, InputIt last, unsigned threads = 1);
  
      /// Inserts a value into the BST.
      void insert(const T& value);
@@ -73,208 +149,388 @@
       */
      bool search(const T& value) const;
  
+     /// Returns the number of elements in the BST.
+     std::size_t size() const { return detail::subtreeSize(root_); }
+
+     /// Checks if the BST is empty.
+     bool empty() const { return root_ == nullptr; }
+
+     /**
+      * @brief Counts the elements less than a value.
+      * @param value Value to rank; need not be present.
+      * @return Number of elements that compare less than @p value.
+      */
+     std::size_t rank(const T& value) const;
+
+     /**
+      * @brief Returns the element at a position in sorted order.
+      * @param k Zero-based position; select(0) is the minimum.
+      * @return Reference to the k-th smallest element.
+      * @throws std::out_of_range if k >= size().
+      */
+     const T& select(std::size_t k) const;
+
+     /**
+      * @brief Counts the elements in the half-open range [lo, hi).
+      * @return Number of elements x with lo <= x < hi; 0 if hi <= lo.
+      */
+     std::size_t count_range(const T& lo, const T& hi) const;
+
      /// Performs an in-order traversal of the BST.
      void inOrderTraversal() const;
+
+     /**
+      * @brief Returns the number of nodes on the longest root-to-leaf path.
+      * @return Height of the tree; 0 if empty.
+      */
+     std::size_t height() const;
  
      /**
-      * @brief In-order iterator class.
+      * @brief Bidirectional in-order iterator (see detail::TreeIterator).
+      * @tparam Const True for const_iterator.
       */
-     class iterator {
+     template<bool Const>
+     using Iterator = detail::TreeIterator<TreeNode<T>, Const>;
+
+     /// Mutable in-order iterator.
+     using iterator = Iterator<false>;
+     /// Read-only in-order iterator.
+     using const_iterator = Iterator<true>;
+
+     /// Returns iterator to beginning of in-order traversal.
+     iterator begin() { return iterator(detail::findMin(root_), &root_); }
+     /// Returns iterator representing end of traversal.
+     iterator end() { return iterator(nullptr, &root_); }
+     /// Returns const iterator to beginning of in-order traversal.
+     const_iterator begin() const { return const_iterator(detail::findMin(root_), &root_); }
+     /// Returns const iterator representing end of traversal.
+     const_iterator end() const { return const_iterator(nullptr, &root_); }
+     /// Returns const iterator to beginning of in-order traversal.
+     const_iterator cbegin() const { return begin(); }
+     /// Returns const iterator representing end of traversal.
+     const_iterator cend() const { return end(); }
+
+     /**
+      * @brief A lazily iterated sub-sequence [first, last) of the tree.
+      *
+      * Holds only the two bounding iterators; elements are visited on demand
+      * through the tree's iterators.
+      *
+      * @tparam It iterator or const_iterator.
+      */
+     template<typename It>
+     class Range {
      public:
-         /**
-          * @brief Constructs an iterator starting at a given node.
-          * @param root Root node to start the traversal.
-          */
-         iterator(TreeNode<T>* root) { pushLeft(root); }
- 
-         /// Dereferences the iterator.
-         T& operator*() { return node_stack.top()->data; }
- 
-         /// Prefix increment operator.
-         iterator& operator++() {
-             TreeNode<T>* node = node_stack.top();
-             node_stack.pop();
-             pushLeft(node->right);
-             return *this;
-         }
- 
-         /// Inequality comparison operator.
-         bool operator!=(const iterator& other) const {
-             return node_stack != other.node_stack;
-         }
+         /// Constructs the range [first, last).
+         Range(It first, It last) : first_(first), last_(last) {}
+         /// Returns iterator to the first element of the range.
+         It begin() const { return first_; }
+         /// Returns iterator past the last element of the range.
+         It end() const { return last_; }
+         /// Checks if the range contains no elements.
+         bool empty() const { return first_ == last_; }
+
      private:
-         std::stack<TreeNode<T>*> node_stack; ///< Stack for traversal.
-         void pushLeft(TreeNode<T>* node) {
-             while (node) {
-                 node_stack.push(node);
-                 node = node->left;
-             }
-         }
-         friend class BinarySearchTree<T>;
+         It first_; ///< First element.
+         It last_;  ///< One past the last element.
      };
- 
-     /// Returns iterator to beginning of in-order traversal.
-     iterator begin() { return iterator(root_); }
-     /// Returns iterator representing end of traversal.
-     iterator end() { return iterator(nullptr); }
+
+     /// Returns an iterator to the element equivalent to @p value, or end().
+     iterator find(const T& value) { return iterator(findNode(value), &root_); }
+     /// Const version of find().
+     const_iterator find(const T& value) const { return const_iterator(findNode(value), &root_); }
+
+     /// Returns an iterator to the first element not less than @p value, or end().
+     iterator lower_bound(const T& value) { return iterator(lowerBoundNode(value), &root_); }
+     /// Const version of lower_bound().
+     const_iterator lower_bound(const T& value) const { return const_iterator(lowerBoundNode(value), &root_); }
+
+     /// Returns an iterator to the first element greater than @p value, or end().
+     iterator upper_bound(const T& value) { return iterator(upperBoundNode(value), &root_); }
+     /// Const version of upper_bound().
+     const_iterator upper_bound(const T& value) const { return const_iterator(upperBoundNode(value), &root_); }
+
+     /// Returns the range of elements equivalent to @p value (at most one).
+     Range<iterator> equal_range(const T& value) {
+         return Range<iterator>(lower_bound(value), upper_bound(value));
+     }
+     /// Const version of equal_range().
+     Range<const_iterator> equal_range(const T& value) const {
+         return Range<const_iterator>(lower_bound(value), upper_bound(value));
+     }
+
+     /**
+      * @brief Returns a view of the elements in [lo, hi).
+      *
+      * Both bounds are located in O(height); iterating the view then costs
+      * amortized O(1) per element. The view is empty if hi <= lo.
+      */
+     Range<iterator> range(const T& lo, const T& hi) {
+         iterator first = lower_bound(lo);
+         return Range<iterator>(first, lo < hi ? lower_bound(hi) : first);
+     }
+     /// Const version of range().
+     Range<const_iterator> range(const T& lo, const T& hi) const {
+         const_iterator first = lower_bound(lo);
+         return Range<const_iterator>(first, lo < hi ? lower_bound(hi) : first);
+     }
  
  private:
-     TreeNode<T>* root_; ///< Root node of the BST.
+     /// Root node of the BST; mutable because a self-adjusting Balance policy
+     /// restructures the tree on lookups (see TreapBalance).
+     mutable TreeNode<T>* root_;
+
+     /// Join-based set algorithms (TreeSetOps.hpp) relink nodes of AVL trees.
+     friend struct detail::TreeJoin<T>;
  
-     /// Recursively inserts a value starting from a node.
-     void insert(TreeNode<T>*& node, const T& value);
-     /// Recursively removes a value.
-     bool remove(TreeNode<T>*& node, const T& value);
-     /// Finds the minimum value node in a subtree.
-     TreeNode<T>* findMin(TreeNode<T>* node);
-     /// Recursively searches for a value.
-     bool search(TreeNode<T>* node, const T& value) const;
-     /// Recursively performs in-order traversal.
-     void inOrderTraversal(TreeNode<T>* node) const;
-     /// Recursively destroys the BST.
-     void destroy(TreeNode<T>* node);
-     /// Recursively clones a BST.
-     TreeNode<T>* clone(TreeNode<T>* node);
+     // The three descents below pass the node they find to Balance::afterAccess.
+     /// Returns the node holding an equivalent value, or null.
+     TreeNode<T>* findNode(const T& value) const;
+     /// Returns the first node not less than value, or null.
+     TreeNode<T>* lowerBoundNode(const T& value) const;
+     /// Returns the first node greater than value, or null.
+     TreeNode<T>* upperBoundNode(const T& value) const;
+     /**
+      * Builds a balanced subtree from the next @p count distinct elements at
+      * @p it, in order. Recursion depth is O(log n). Sets @p height.
+      */
+     template<typename ForwardIt>
+     static TreeNode<T>* buildBalanced(ForwardIt& it, ForwardIt last, std::size_t count,
+                                       std::size_t depth, std::size_t fullLevels, std::size_t& height);
  };
 
  // Define Tree as an alias for BinarySearchTree for backward compatibility
  template<typename T>
  using Tree = BinarySearchTree<T>;
- 
+
+ /// A BinarySearchTree kept balanced as an AVL tree.
  template<typename T>
- BinarySearchTree<T>::BinarySearchTree() : root_(nullptr) {}
- 
+ using AVLTree = BinarySearchTree<T, AVLBalance>;
+
+ /// A BinarySearchTree kept balanced as a red-black tree.
  template<typename T>
- TreeNode<T>* BinarySearchTree<T>::clone(TreeNode<T>* node) {
-     if (!node) return nullptr;
-     TreeNode<T>* new_node = new TreeNode<T>(node->data);
-     new_node->left = clone(node->left);
-     new_node->right = clone(node->right);
-     return new_node;
- }
- 
+ using RedBlackTree = BinarySearchTree<T, RedBlackBalance>;
+
+ /// A BinarySearchTree that moves frequently found elements toward the root.
+ /// Its lookups are not thread-safe even when const.
  template<typename T>
- BinarySearchTree<T>::BinarySearchTree(const BinarySearchTree& other)
-     : root_(clone(other.root_)) {}
+ using Treap = BinarySearchTree<T, TreapBalance>;
  
- template<typename T>
- BinarySearchTree<T>::BinarySearchTree(BinarySearchTree&& other) noexcept 
+ template<typename T, typename Balance>
+ BinarySearchTree<T, Balance>::BinarySearchTree() : root_(nullptr) {}
+ 
+ template<typename T, typename Balance>
+ template<typename ForwardIt>
+ TreeNode<T>* BinarySearchTree<T, Balance>::buildBalanced(ForwardIt& it, ForwardIt last, std::size_t count,
+                                                          std::size_t depth, std::size_t fullLevels,
+                                                          std::size_t& height) {
+     if (count == 0) {
+         height = 0;
+         return nullptr;
+     }
+     const std::size_t leftCount = (count - 1) / 2;
+     std::size_t leftHeight, rightHeight;
+     TreeNode<T>* left = buildBalanced(it, last, leftCount, depth + 1, fullLevels, leftHeight);
+     TreeNode<T>* node;
+     try {
+         node = new TreeNode<T>(*it);
+     } catch (...) {
+         detail::destroyTree(left);
+         throw;
+     }
+     // Skip elements equivalent to the one just taken.
+     do {
+         ++it;
+     } while (it != last && !(node->data < *it));
+     node->left = left;
+     if (left)
+         left->parent = node;
+     try {
+         node->right = buildBalanced(it, last, count - 1 - leftCount, depth + 1, fullLevels, rightHeight);
+     } catch (...) {
+         detail::destroyTree(node);
+         throw;
+     }
+     if (node->right)
+         node->right->parent = node;
+     height = 1 + std::max(leftHeight, rightHeight);
+     node->size = count;
+     node->tag = Balance::buildTag(height, depth, fullLevels);
+     return node;
+ }
+
+ template<typename T, typename Balance>
+ template<typename ForwardIt>
+ BinarySearchTree<T, Balance> BinarySearchTree<T, Balance>::from_sorted(ForwardIt first, ForwardIt last) {
+     std::size_t count = 0;
+     for (ForwardIt prev = first, it = first; it != last; prev = it, ++it) {
+         if (it == first || *prev < *it)
+             ++count;
+     }
+     std::size_t fullLevels = 0;
+     while ((std::size_t(2) << fullLevels) - 1 <= count)
+         ++fullLevels;
+     std::size_t height;
+     BinarySearchTree tree;
+     tree.root_ = buildBalanced(first, last, count, 1, fullLevels, height);
+     return tree;
+ }
+
+ template<typename T, typename Balance>
+ template<typename InputIt>
+ BinarySearchTree<T, Balance> BinarySearchTree<T, Balance>::from_unsorted(InputIt first, InputIt last,
+                                                                         unsigned threads) {
+     std::vector<T> sorted(first, last);
+     detail::parallelSort(sorted.begin(), sorted.end(), threads);
+     return from_sorted(sorted.begin(), sorted.end());
+ }
+
+ template<typename T, typename Balance>
+ BinarySearchTree<T, Balance>::BinarySearchTree(const BinarySearchTree& other)
+     : root_(detail::cloneTree(other.root_)) {}
+ 
+ template<typename T, typename Balance>
+ BinarySearchTree<T, Balance>::BinarySearchTree(BinarySearchTree&& other) noexcept 
      : root_(other.root_) {
      other.root_ = nullptr;
  }
  
- template<typename T>
- BinarySearchTree<T>& BinarySearchTree<T>::operator=(BinarySearchTree other) {
+ template<typename T, typename Balance>
+ BinarySearchTree<T, Balance>& BinarySearchTree<T, Balance>::operator=(BinarySearchTree other) {
      std::swap(root_, other.root_);
      return *this;
  }
  
- template<typename T>
- BinarySearchTree<T>::~BinarySearchTree() {
-     destroy(root_);
+ template<typename T, typename Balance>
+ BinarySearchTree<T, Balance>::~BinarySearchTree() {
+     detail::destroyTree(root_);
  }
  
- template<typename T>
- void BinarySearchTree<T>::destroy(TreeNode<T>* node) {
-     if (node) {
-         destroy(node->left);
-         destroy(node->right);
-         delete node;
+ template<typename T, typename Balance>
+ void BinarySearchTree<T, Balance>::insert(const T& value) {
+     TreeNode<T>* parent;
+     TreeNode<T>** link;
+     if (TreeNode<T>* found = detail::descend<detail::IdentityKey>(root_, value, std::less<>(), parent, link)) {
+         Balance::afterAccess(root_, found);
+         return;
      }
+     detail::attach<Balance>(root_, new TreeNode<T>(value), parent, link);
  }
- 
- template<typename T>
- void BinarySearchTree<T>::insert(const T& value) {
-     insert(root_, value);
+
+ template<typename T, typename Balance>
+ bool BinarySearchTree<T, Balance>::remove(const T& value) {
+     TreeNode<T>* node = findNode(value);
+     if (!node)
+         return false;
+     detail::eraseNode<Balance>(root_, node);
+     return true;
+ }
+
+ template<typename T, typename Balance>
+ TreeNode<T>* BinarySearchTree<T, Balance>::findNode(const T& value) const {
+     TreeNode<T>* node = detail::findNode<detail::IdentityKey>(root_, value, std::less<>());
+     if (node)
+         Balance::afterAccess(root_, node);
+     return node;
  }
  
- template<typename T>
- void BinarySearchTree<T>::insert(TreeNode<T>*& node, const T& value) {
-     if (!node)
-         node = new TreeNode<T>(value);
-     else if (value < node->data)
-         insert(node->left, value);
-     else if (value > node->data)
-         insert(node->right, value);
+ template<typename T, typename Balance>
+ TreeNode<T>* BinarySearchTree<T, Balance>::lowerBoundNode(const T& value) const {
+     TreeNode<T>* best = detail::lowerBoundNode<detail::IdentityKey>(root_, value, std::less<>());
+     if (best)
+         Balance::afterAccess(root_, best);
+     return best;
  }
 
- template<typename T>
- bool BinarySearchTree<T>::remove(const T& value) {
-     return remove(root_, value);
+ template<typename T, typename Balance>
+ TreeNode<T>* BinarySearchTree<T, Balance>::upperBoundNode(const T& value) const {
+     TreeNode<T>* best = detail::upperBoundNode<detail::IdentityKey>(root_, value, std::less<>());
+     if (best)
+         Balance::afterAccess(root_, best);
+     return best;
  }
 
- template<typename T>
- bool BinarySearchTree<T>::remove(TreeNode<T>*& node, const T& value) {
-     if (!node) return false;
-     
-     if (value < node->data) {
-         return remove(node->left, value);
-     } else if (value > node->data) {
-         return remove(node->right, value);
-     } else {
-         // Found the node to remove
-         
-         // Case 1: No children
-         if (!node->left && !node->right) {
-             delete node;
-             node = nullptr;
-         }
-         // Case 2: One child
-         else if (!node->left) {
-             TreeNode<T>* temp = node;
+ template<typename T, typename Balance>
+ bool BinarySearchTree<T, Balance>::search(const T& value) const {
+     return findNode(value) != nullptr;
+ }
+
+ template<typename T, typename Balance>
+ std::size_t BinarySearchTree<T, Balance>::rank(const T& value) const {
+     std::size_t count = 0;
+     const TreeNode<T>* node = root_;
+     while (node) {
+         if (node->data < value) {
+             count += detail::subtreeSize(node->left) + 1;
              node = node->right;
-             delete temp;
-         }
-         else if (!node->right) {
-             TreeNode<T>* temp = node;
+         } else {
              node = node->left;
-             delete temp;
          }
-         // Case 3: Two children
-         else {
-             TreeNode<T>* temp = findMin(node->right);
-             node->data = temp->data;
-             remove(node->right, temp->data);
+     }
+     return count;
+ }
+
+ template<typename T, typename Balance>
+ const T& BinarySearchTree<T, Balance>::select(std::size_t k) const {
+     if (k >= size())
+         throw std::out_of_range("BinarySearchTree::select index out of range");
+     const TreeNode<T>* node = root_;
+     while (true) {
+         std::size_t leftSize = detail::subtreeSize(node->left);
+         if (k < leftSize) {
+             node = node->left;
+         } else if (k == leftSize) {
+             return node->data;
+         } else {
+             k -= leftSize + 1;
+             node = node->right;
          }
-         return true;
      }
  }
 
- template<typename T>
- TreeNode<T>* BinarySearchTree<T>::findMin(TreeNode<T>* node) {
-     if (!node) return nullptr;
+ template<typename T, typename Balance>
+ std::size_t BinarySearchTree<T, Balance>::count_range(const T& lo, const T& hi) const {
+     if (!(lo < hi))
+         return 0;
+     return rank(hi) - rank(lo);
+ }
+
+ template<typename T, typename Balance>
+ std::size_t BinarySearchTree<T, Balance>::height() const {
+     // Walk the nodes in order via parent pointers, tracking the depth.
+     const TreeNode<T>* node = root_;
+     if (!node) return 0;
+     std::size_t depth = 1, best = 0;
      while (node->left) {
          node = node->left;
+         ++depth;
      }
-     return node;
- }
- 
- template<typename T>
- bool BinarySearchTree<T>::search(const T& value) const {
-     return search(root_, value);
- }
- 
- template<typename T>
- bool BinarySearchTree<T>::search(TreeNode<T>* node, const T& value) const {
-     if (!node)
-         return false;
-     if (node->data == value)
-         return true;
-     return value < node->data ? search(node->left, value) : search(node->right, value);
- }
- 
- template<typename T>
- void BinarySearchTree<T>::inOrderTraversal() const {
-     inOrderTraversal(root_);
+     while (node) {
+         if (depth > best)
+             best = depth;
+         if (node->right) {
+             node = node->right;
+             ++depth;
+             while (node->left) {
+                 node = node->left;
+                 ++depth;
+             }
+         } else {
+             const TreeNode<T>* child;
+             do {
+                 child = node;
+                 node = node->parent;
+                 --depth;
+             } while (node && node->right == child);
+         }
+     }
+     return best;
  }
- 
- template<typename T>
- void BinarySearchTree<T>::inOrderTraversal(TreeNode<T>* node) const {
-     if (node) {
-         inOrderTraversal(node->left);
+
+ template<typename T, typename Balance>
+ void BinarySearchTree<T, Balance>::inOrderTraversal() const {
+     for (TreeNode<T>* node = detail::findMin(root_); node; node = detail::successor(node))
          std::cout << node->data << " ";
-         inOrderTraversal(node->right);
-     }
  }
  
  } // namespace dsa
@@ -0,0 +1,401 @@
+/**
+ * @file TreeBalance.hpp
+ * @brief Declares the balancing policies used by BinarySearchTree.
+ *
+ * A policy is notified after every structural change to the tree and may
+ * restructure it with rotations. Policies work on any node type that has
+ * left, right and parent pointers, a subtree @c size count and an integer
+ * @c tag field that the policy owns (height for AVL, color for red-black).
+ * The shared rotations keep @c size current, so every policy preserves it.
+ *
+ * @section Policies
+ * - NoBalance: plain BST, O(n) worst case (e.g. on sorted input)
+ * - AVLBalance: height-balanced, height <= 1.44 log2(n)
+ * - RedBlackBalance: color-balanced, height <= 2 log2(n + 1), fewer rotations on erase
+ * - TreapBalance: randomized, O(log n) expected; frequently found keys rise toward the root
+ */
+
+#ifndef DSA_TREEBALANCE_HPP
+#define DSA_TREEBALANCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace dsa {
+
+namespace detail {
+
+/// Number of nodes in a subtree; 0 for an empty one.
+template<typename Node>
+std::size_t subtreeSize(const Node* n) { return n ? n->size : 0; }
+
+/// Recomputes n's subtree size from its children.
+template<typename Node>
+void updateSize(Node* n) { n->size = 1 + subtreeSize(n->left) + subtreeSize(n->right); }
+
+/// Makes newChild take oldChild's place under parent (or as root).
+template<typename Node>
+void replaceChild(Node*& root, Node* parent, Node* oldChild, Node* newChild) {
+    if (!parent)
+        root = newChild;
+    else if (parent->left == oldChild)
+        parent->left = newChild;
+    else
+        parent->right = newChild;
+}
+
+/// Rotates x's right child up into x's place.
+template<typename Node>
+void rotateLeft(Node*& root, Node* x) {
+    Node* y = x->right;
+    x->right = y->left;
+    if (y->left)
+        y->left->parent = x;
+    y->parent = x->parent;
+    replaceChild(root, x->parent, x, y);
+    y->left = x;
+    x->parent = y;
+    y->size = x->size;
+    updateSize(x);
+}
+
+/// Rotates x's left child up into x's place.
+template<typename Node>
+void rotateRight(Node*& root, Node* x) {
+    Node* y = x->left;
+    x->left = y->right;
+    if (y->right)
+        y->right->parent = x;
+    y->parent = x->parent;
+    replaceChild(root, x->parent, x, y);
+    y->right = x;
+    x->parent = y;
+    y->size = x->size;
+    updateSize(x);
+}
+
+} // namespace detail
+
+/**
+ * @struct NoBalance
+ * @brief Policy that never restructures the tree.
+ */
+struct NoBalance {
+    /// Called after @p node has been linked in as a leaf.
+    template<typename Node>
+    static void afterInsert(Node*&, Node*) {}
+
+    /**
+     * @brief Called after a node has been unlinked.
+     *
+     * @param root Tree root (may be updated).
+     * @param x Node that took the unlinked node's place (may be null).
+     * @param xParent Parent of @p x.
+     * @param removedTag Tag of the node that was physically unlinked.
+     */
+    template<typename Node>
+    static void afterErase(Node*&, Node*, Node*, int) {}
+
+    /// Called after a lookup found @p node.
+    template<typename Node>
+    static void afterAccess(Node*&, Node*) {}
+
+    /**
+     * @brief Tag for a node of a tree built already balanced from sorted input.
+     *
+     * In such a tree every level but the last is full.
+     *
+     * @param height Height of the node's subtree.
+     * @param depth Depth of the node (the root has depth 1).
+     * @param fullLevels Number of completely filled levels in the tree.
+     */
+    static int buildTag(std::size_t, std::size_t, std::size_t) { return 0; }
+};
+
+/**
+ * @struct AVLBalance
+ * @brief Policy keeping sibling subtree heights within one of each other.
+ *
+ * The node tag stores the subtree height (a leaf has height 1).
+ */
+struct AVLBalance {
+    /// Retraces from the new leaf upwards, stopping once a height is unchanged.
+    template<typename Node>
+    static void afterInsert(Node*& root, Node* node) {
+        node->tag = 1;
+        for (Node* n = node->parent; n; n = n->parent) {
+            int oldHeight = n->tag;
+            update(n);
+            n = rebalance(root, n);
+            // Once a subtree's height is unchanged, nothing above it changes.
+            if (n->tag == oldHeight)
+                break;
+        }
+    }
+
+    /// Retraces from the unlinked position all the way to the root.
+    template<typename Node>
+    static void afterErase(Node*& root, Node*, Node* xParent, int) {
+        for (Node* n = xParent; n; n = n->parent) {
+            update(n);
+            n = rebalance(root, n);
+        }
+    }
+
+    /// Lookups do not restructure the tree.
+    template<typename Node>
+    static void afterAccess(Node*&, Node*) {}
+
+    /// A built node's tag is simply its subtree height.
+    static int buildTag(std::size_t height, std::size_t, std::size_t) {
+        return static_cast<int>(height);
+    }
+
+private:
+    /// Height of a subtree; 0 for an empty one.
+    template<typename Node>
+    static int height(const Node* n) { return n ? n->tag : 0; }
+
+    /// Recomputes n's height from its children.
+    template<typename Node>
+    static void update(Node* n) {
+        int l = height(n->left), r = height(n->right);
+        n->tag = 1 + (l > r ? l : r);
+    }
+
+    /// Rotations that keep the heights of the two moved nodes current.
+    template<typename Node>
+    static void rotateLeft(Node*& root, Node* x) {
+        detail::rotateLeft(root, x);
+        update(x);
+        update(x->parent);
+    }
+
+    template<typename Node>
+    static void rotateRight(Node*& root, Node* x) {
+        detail::rotateRight(root, x);
+        update(x);
+        update(x->parent);
+    }
+
+    /// Restores the AVL property at n; returns the node now rooting n's subtree.
+    template<typename Node>
+    static Node* rebalance(Node*& root, Node* n) {
+        int balance = height(n->left) - height(n->right);
+        if (balance > 1) {
+            if (height(n->left->left) < height(n->left->right))
+                rotateLeft(root, n->left);
+            rotateRight(root, n);
+            return n->parent;
+        }
+        if (balance < -1) {
+            if (height(n->right->right) < height(n->right->left))
+                rotateRight(root, n->right);
+            rotateLeft(root, n);
+            return n->parent;
+        }
+        return n;
+    }
+};
+
+/**
+ * @struct RedBlackBalance
+ * @brief Policy maintaining red-black invariants.
+ *
+ * The node tag stores the color; null children count as black.
+ */
+struct RedBlackBalance {
+    static constexpr int red = 0;   ///< Tag value of red nodes.
+    static constexpr int black = 1; ///< Tag value of black nodes.
+
+    /// Colors the new leaf red and fixes any red-red violation above it.
+    template<typename Node>
+    static void afterInsert(Node*& root, Node* node) {
+        node->tag = red;
+        while (node != root && node->parent->tag == red) {
+            Node* parent = node->parent;
+            Node* grand = parent->parent;
+            if (parent == grand->left) {
+                Node* uncle = grand->right;
+                if (isRed(uncle)) {
+                    parent->tag = uncle->tag = black;
+                    grand->tag = red;
+                    node = grand;
+                    continue;
+                }
+                if (node == parent->right) {
+                    detail::rotateLeft(root, parent);
+                    node = parent;
+                    parent = node->parent;
+                }
+                parent->tag = black;
+                grand->tag = red;
+                detail::rotateRight(root, grand);
+            } else {
+                Node* uncle = grand->left;
+                if (isRed(uncle)) {
+                    parent->tag = uncle->tag = black;
+                    grand->tag = red;
+                    node = grand;
+                    continue;
+                }
+                if (node == parent->left) {
+                    detail::rotateRight(root, parent);
+                    node = parent;
+                    parent = node->parent;
+                }
+                parent->tag = black;
+                grand->tag = red;
+                detail::rotateLeft(root, grand);
+            }
+        }
+        root->tag = black;
+    }
+
+    /// Restores equal black heights after a black node was unlinked.
+    template<typename Node>
+    static void afterErase(Node*& root, Node* x, Node* xParent, int removedTag) {
+        if (removedTag != black)
+            return;
+        // x carries an extra black; push it up or resolve it with rotations.
+        while (x != root && !isRed(x)) {
+            if (x == xParent->left) {
+                Node* w = xParent->right;
+                if (isRed(w)) {
+                    w->tag = black;
+                    xParent->tag = red;
+                    detail::rotateLeft(root, xParent);
+                    w = xParent->right;
+                }
+                if (!isRed(w->left) && !isRed(w->right)) {
+                    w->tag = red;
+                    x = xParent;
+                    xParent = x->parent;
+                } else {
+                    if (!isRed(w->right)) {
+                        w->left->tag = black;
+                        w->tag = red;
+                        detail::rotateRight(root, w);
+                        w = xParent->right;
+                    }
+                    w->tag = xParent->tag;
+                    xParent->tag = black;
+                    w->right->tag = black;
+                    detail::rotateLeft(root, xParent);
+                    x = root;
+                }
+            } else {
+                Node* w = xParent->left;
+                if (isRed(w)) {
+                    w->tag = black;
+                    xParent->tag = red;
+                    detail::rotateRight(root, xParent);
+                    w = xParent->left;
+                }
+                if (!isRed(w->left) && !isRed(w->right)) {
+                    w->tag = red;
+                    x = xParent;
+                    xParent = x->parent;
+                } else {
+                    if (!isRed(w->left)) {
+                        w->right->tag = black;
+                        w->tag = red;
+                        detail::rotateLeft(root, w);
+                        w = xParent->left;
+                    }
+                    w->tag = xParent->tag;
+                    xParent->tag = black;
+                    w->left->tag = black;
+                    detail::rotateRight(root, xParent);
+                    x = root;
+                }
+            }
+        }
+        if (x)
+            x->tag = black;
+    }
+
+    /// Lookups do not restructure the tree.
+    template<typename Node>
+    static void afterAccess(Node*&, Node*) {}
+
+    /// Nodes on an incomplete last level are red; all others are black.
+    static int buildTag(std::size_t, std::size_t depth, std::size_t fullLevels) {
+        return depth > fullLevels ? red : black;
+    }
+
+private:
+    /// Null children count as black.
+    template<typename Node>
+    static bool isRed(const Node* n) { return n && n->tag == red; }
+};
+
+/**
+ * @struct TreapBalance
+ * @brief Randomized treap whose priorities grow with each access.
+ *
+ * The node tag stores a random priority; every parent's priority is at least
+ * its children's. A new node draws one priority; each successful lookup draws
+ * another and keeps the larger, rotating the node up if it now outranks its
+ * parent. A key hit k times thus holds the maximum of k + 1 draws; among m
+ * lookups its expected depth is O(log(m / k)), so hot keys settle near the
+ * root, while an access that draws no larger priority changes nothing.
+ * Because lookups may rotate, even const lookups on a tree using this
+ * policy must not run concurrently.
+ */
+struct TreapBalance {
+    /// Gives the new leaf a random priority and rotates it into heap order.
+    template<typename Node>
+    static void afterInsert(Node*& root, Node* node) {
+        node->tag = drawPriority();
+        siftUp(root, node);
+    }
+
+    /// Unlinking keeps heap order: the node that moves up inherits the
+    /// removed node's priority, and a spliced child moves below an ancestor.
+    template<typename Node>
+    static void afterErase(Node*&, Node*, Node*, int) {}
+
+    /// Boosts the priority of a found node.
+    template<typename Node>
+    static void afterAccess(Node*& root, Node* node) {
+        int priority = drawPriority();
+        if (priority > node->tag) {
+            node->tag = priority;
+            siftUp(root, node);
+        }
+    }
+
+    /// Priorities decrease with depth; a subtree of height h gets the value
+    /// typical of the largest of its 2^h - 1 random draws.
+    static int buildTag(std::size_t height, std::size_t, std::size_t) {
+        const int top = std::numeric_limits<int>::max();
+        return height >= 31 ? top : top - (top >> height);
+    }
+
+private:
+    /// Returns a pseudo-random non-negative priority (xorshift32, per thread).
+    static int drawPriority() {
+        thread_local std::uint32_t state = 2463534242u;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return static_cast<int>(state >> 1);
+    }
+
+    /// Rotates x up while it outranks its parent.
+    template<typename Node>
+    static void siftUp(Node*& root, Node* x) {
+        while (x->parent && x->parent->tag < x->tag) {
+            if (x->parent->left == x)
+                detail::rotateRight(root, x->parent);
+            else
+                detail::rotateLeft(root, x->parent);
+        }
+    }
+};
+
+} // namespace dsa
+
+#endif // DSA_TREEBALANCE_HPP
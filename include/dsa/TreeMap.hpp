@@ -0,0 +1,321 @@
+/**
+ * @file TreeMap.hpp
+ * @brief Declares an ordered key-value map built on a balanced search tree.
+ *
+ * TreeMap stores std::pair<const Key, Value> entries in nodes shaped like
+ * TreeNode, so the TreeBalance.hpp policies keep it balanced and the node
+ * operations of TreeNodeOps.hpp serve both containers. Only keys are
+ * compared, using a user-supplied Compare. When Compare declares
+ * @c is_transparent (e.g. std::less<>), lookups accept any type the
+ * comparator can compare with Key, without building a temporary Key.
+ *
+ * @section Complexity
+ * - try_emplace/insert_or_assign/remove/find: O(log n) with a balancing policy
+ * - lower_bound/upper_bound: O(log n)
+ * - Iterator ++/--: amortized O(1)
+ *
+ * @section Example
+ * @code
+ * dsa::TreeMap<std::string, int, std::less<>> ages;
+ * ages.insert_or_assign("ada", 36);
+ * ages.try_emplace("alan", 41);
+ * auto it = ages.find("ada");  // no std::string temporary
+ * @endcode
+ */
+
+#ifndef DSA_TREEMAP_HPP
+#define DSA_TREEMAP_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "TreeBalance.hpp"
+#include "TreeNodeOps.hpp"
+
+namespace dsa {
+
+namespace detail {
+
+/// True if C declares is_transparent; K only makes the check SFINAE-dependent.
+template<typename C, typename K, typename = void>
+struct IsTransparent : std::false_type {};
+
+template<typename C, typename K>
+struct IsTransparent<C, K, std::void_t<typename C::is_transparent>> : std::true_type {};
+
+} // namespace detail
+
+/**
+ * @struct TreeMapNode
+ * @brief Node of a TreeMap: one key-value entry plus tree links.
+ */
+template<typename Key, typename Value>
+struct TreeMapNode {
+    std::pair<const Key, Value> data; ///< Stored entry.
+    TreeMapNode* left;                ///< Pointer to left child.
+    TreeMapNode* right;               ///< Pointer to right child.
+    TreeMapNode* parent;              ///< Pointer to parent (null for the root).
+    std::size_t size;                 ///< Number of nodes in the subtree rooted here.
+    int tag;                          ///< Balancing metadata owned by the Balance policy.
+
+    /// Constructs the entry in place from @p args.
+    template<typename... Args>
+    explicit TreeMapNode(Args&&... args)
+        : data(std::forward<Args>(args)...), left(nullptr), right(nullptr),
+          parent(nullptr), size(1), tag(0) {}
+};
+
+/**
+ * @class TreeMap
+ * @brief An ordered map from unique keys to values.
+ *
+ * @tparam Key Type of keys.
+ * @tparam Value Type of mapped values.
+ * @tparam Compare Strict weak ordering on keys.
+ * @tparam Balance Balancing policy: NoBalance, AVLBalance or RedBlackBalance.
+ */
+template<typename Key, typename Value, typename Compare = std::less<Key>,
+         typename Balance = RedBlackBalance>
+class TreeMap {
+    using Node = TreeMapNode<Key, Value>;
+
+    /// Enables heterogeneous overloads only for transparent comparators.
+    template<typename K>
+    using Transparent = typename std::enable_if<detail::IsTransparent<Compare, K>::value, int>::type;
+
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+
+    /**
+     * @brief Bidirectional in-order iterator over the entries (see detail::TreeIterator).
+     * @tparam Const True for const_iterator.
+     */
+    template<bool Const>
+    using Iterator = detail::TreeIterator<Node, Const>;
+
+    /// Mutable iterator; keys are const, values may be modified.
+    using iterator = Iterator<false>;
+    /// Read-only iterator.
+    using const_iterator = Iterator<true>;
+
+    /// Constructs an empty map.
+    TreeMap() : root_(nullptr), comp_() {}
+    /// Constructs an empty map with the given comparator.
+    explicit TreeMap(const Compare& comp) : root_(nullptr), comp_(comp) {}
+    /// Copy constructor.
+    TreeMap(const TreeMap& other);
+    /// Move constructor.
+    TreeMap(TreeMap&& other) noexcept : root_(other.root_), comp_(other.comp_) { other.root_ = nullptr; }
+    /**
+     * @brief Copy assignment operator.
+     * @param other Another map.
+     * @return Reference to this map.
+     */
+    TreeMap& operator=(TreeMap other) {
+        std::swap(root_, other.root_);
+        std::swap(comp_, other.comp_);
+        return *this;
+    }
+    /// Destructor.
+    ~TreeMap() { detail::destroyTree(root_); }
+
+    /**
+     * @brief Inserts an entry constructed from @p args unless the key exists.
+     *
+     * Descends once; the value is only constructed if the key is absent.
+     *
+     * @return Iterator to the entry with the key, and true if it was inserted.
+     */
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        return emplaceUnique(key, std::forward<Args>(args)...);
+    }
+
+    /// Move-key version of try_emplace().
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+        return emplaceUnique(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Inserts an entry, or assigns @p value if the key exists.
+     *
+     * Descends once.
+     *
+     * @return Iterator to the entry, and true if it was inserted.
+     */
+    template<typename M>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, M&& value);
+
+    /// Inserts key/value unless the key exists; equivalent to try_emplace(key, value).
+    std::pair<iterator, bool> insert(const Key& key, const Value& value) { return try_emplace(key, value); }
+
+    /// Returns the value for @p key, inserting a value-initialized one if absent.
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    /**
+     * @brief Returns the value for @p key.
+     * @throws std::out_of_range if the key is absent.
+     */
+    Value& at(const Key& key) { return atImpl(key); }
+    /// Const version of at().
+    const Value& at(const Key& key) const { return const_cast<TreeMap*>(this)->atImpl(key); }
+
+    /**
+     * @brief Removes the entry with @p key.
+     * @return True if removed, false if not found.
+     */
+    bool remove(const Key& key);
+
+    /**
+     * @brief Removes the entry at @p pos.
+     * @return Iterator to the entry that followed it.
+     */
+    iterator erase(const_iterator pos);
+
+    /// Returns an iterator to the entry with @p key, or end().
+    iterator find(const Key& key) { return iterator(findNode(key), &root_); }
+    /// Const version of find().
+    const_iterator find(const Key& key) const { return const_iterator(findNode(key), &root_); }
+    /// Heterogeneous find(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    iterator find(const K& key) { return iterator(findNode(key), &root_); }
+    /// Heterogeneous const find(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    const_iterator find(const K& key) const { return const_iterator(findNode(key), &root_); }
+
+    /// Checks whether an entry with @p key exists.
+    bool contains(const Key& key) const { return findNode(key) != nullptr; }
+    /// Heterogeneous contains(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    bool contains(const K& key) const { return findNode(key) != nullptr; }
+
+    /// Returns an iterator to the first entry whose key is not less than @p key.
+    iterator lower_bound(const Key& key) { return iterator(lowerBoundNode(key), &root_); }
+    /// Const version of lower_bound().
+    const_iterator lower_bound(const Key& key) const { return const_iterator(lowerBoundNode(key), &root_); }
+    /// Heterogeneous lower_bound(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    iterator lower_bound(const K& key) { return iterator(lowerBoundNode(key), &root_); }
+    /// Heterogeneous const lower_bound(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    const_iterator lower_bound(const K& key) const { return const_iterator(lowerBoundNode(key), &root_); }
+
+    /// Returns an iterator to the first entry whose key is greater than @p key.
+    iterator upper_bound(const Key& key) { return iterator(upperBoundNode(key), &root_); }
+    /// Const version of upper_bound().
+    const_iterator upper_bound(const Key& key) const { return const_iterator(upperBoundNode(key), &root_); }
+    /// Heterogeneous upper_bound(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    iterator upper_bound(const K& key) { return iterator(upperBoundNode(key), &root_); }
+    /// Heterogeneous const upper_bound(); available when Compare is transparent.
+    template<typename K, Transparent<K> = 0>
+    const_iterator upper_bound(const K& key) const { return const_iterator(upperBoundNode(key), &root_); }
+
+    /// Returns the number of entries.
+    std::size_t size() const { return detail::subtreeSize(root_); }
+    /// Checks if the map is empty.
+    bool empty() const { return root_ == nullptr; }
+    /// Removes all entries.
+    void clear() { detail::destroyTree(root_); root_ = nullptr; }
+    /// Returns the key comparator.
+    Compare key_comp() const { return comp_; }
+
+    /// Returns iterator to the first entry.
+    iterator begin() { return iterator(detail::findMin(root_), &root_); }
+    /// Returns iterator past the last entry.
+    iterator end() { return iterator(nullptr, &root_); }
+    /// Returns const iterator to the first entry.
+    const_iterator begin() const { return const_iterator(detail::findMin(root_), &root_); }
+    /// Returns const iterator past the last entry.
+    const_iterator end() const { return const_iterator(nullptr, &root_); }
+    /// Returns const iterator to the first entry.
+    const_iterator cbegin() const { return begin(); }
+    /// Returns const iterator past the last entry.
+    const_iterator cend() const { return end(); }
+
+private:
+    Node* root_;    ///< Root node of the tree.
+    Compare comp_;  ///< Key comparator.
+
+    /// Shared implementation of the try_emplace overloads.
+    template<typename K, typename... Args>
+    std::pair<iterator, bool> emplaceUnique(K&& key, Args&&... args);
+
+    Value& atImpl(const Key& key);
+    template<typename K>
+    Node* findNode(const K& key) const { return detail::findNode<detail::FirstKey>(root_, key, comp_); }
+    template<typename K>
+    Node* lowerBoundNode(const K& key) const { return detail::lowerBoundNode<detail::FirstKey>(root_, key, comp_); }
+    template<typename K>
+    Node* upperBoundNode(const K& key) const { return detail::upperBoundNode<detail::FirstKey>(root_, key, comp_); }
+};
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+template<typename K, typename... Args>
+std::pair<typename TreeMap<Key, Value, Compare, Balance>::iterator, bool>
+TreeMap<Key, Value, Compare, Balance>::emplaceUnique(K&& key, Args&&... args) {
+    Node* parent;
+    Node** link;
+    if (Node* found = detail::descend<detail::FirstKey>(root_, key, comp_, parent, link))
+        return {iterator(found, &root_), false};
+    Node* node = new Node(std::piecewise_construct,
+                          std::forward_as_tuple(std::forward<K>(key)),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+    detail::attach<Balance>(root_, node, parent, link);
+    return {iterator(node, &root_), true};
+}
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+template<typename M>
+std::pair<typename TreeMap<Key, Value, Compare, Balance>::iterator, bool>
+TreeMap<Key, Value, Compare, Balance>::insert_or_assign(const Key& key, M&& value) {
+    Node* parent;
+    Node** link;
+    if (Node* found = detail::descend<detail::FirstKey>(root_, key, comp_, parent, link)) {
+        found->data.second = std::forward<M>(value);
+        return {iterator(found, &root_), false};
+    }
+    Node* node = new Node(key, std::forward<M>(value));
+    detail::attach<Balance>(root_, node, parent, link);
+    return {iterator(node, &root_), true};
+}
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+Value& TreeMap<Key, Value, Compare, Balance>::atImpl(const Key& key) {
+    Node* node = findNode(key);
+    if (!node)
+        throw std::out_of_range("TreeMap::at key not found");
+    return node->data.second;
+}
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+bool TreeMap<Key, Value, Compare, Balance>::remove(const Key& key) {
+    Node* node = findNode(key);
+    if (!node)
+        return false;
+    detail::eraseNode<Balance>(root_, node);
+    return true;
+}
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+typename TreeMap<Key, Value, Compare, Balance>::iterator
+TreeMap<Key, Value, Compare, Balance>::erase(const_iterator pos) {
+    Node* next = detail::successor(pos.node_);
+    detail::eraseNode<Balance>(root_, pos.node_);
+    return iterator(next, &root_);
+}
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+TreeMap<Key, Value, Compare, Balance>::TreeMap(const TreeMap& other)
+    : root_(detail::cloneTree(other.root_)), comp_(other.comp_) {}
+
+} // namespace dsa
+
+#endif // DSA_TREEMAP_HPP
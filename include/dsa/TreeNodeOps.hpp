@@ -0,0 +1,349 @@
+/**
+ * @file TreeNodeOps.hpp
+ * @brief Node-level operations shared by BinarySearchTree and TreeMap.
+ *
+ * Both containers keep their elements in nodes with left, right and parent
+ * pointers, a subtree @c size and a Balance-owned @c tag (TreeNode and
+ * TreeMapNode). This header holds everything that works on such nodes
+ * alone: the in-order walk, the bidirectional iterator, descents under a
+ * comparator, linking a new leaf, unlinking a node and handing the repair
+ * to the Balance policy, and O(1)-space copy and destruction.
+ *
+ * Descents are parameterized on a KeyOf policy that extracts the ordering
+ * key from a node's @c data (IdentityKey for sets, FirstKey for maps) and on
+ * a comparator called as comp(a, b), so heterogeneous keys work wherever the
+ * comparator accepts them.
+ */
+
+#ifndef DSA_TREENODEOPS_HPP
+#define DSA_TREENODEOPS_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include "TreeBalance.hpp"
+
+namespace dsa {
+
+template<typename T, typename Balance>
+class BinarySearchTree;
+
+template<typename Key, typename Value, typename Compare, typename Balance>
+class TreeMap;
+
+namespace detail {
+
+/// Orders nodes by their whole @c data.
+struct IdentityKey {
+    template<typename Node>
+    static const auto& get(const Node* n) { return n->data; }
+};
+
+/// Orders nodes by @c data.first, as for key-value entries.
+struct FirstKey {
+    template<typename Node>
+    static const auto& get(const Node* n) { return n->data.first; }
+};
+
+/// Finds the minimum node in a subtree, or null if it is empty.
+template<typename Node>
+Node* findMin(Node* node) {
+    if (!node) return nullptr;
+    while (node->left)
+        node = node->left;
+    return node;
+}
+
+/// Finds the maximum node in a subtree, or null if it is empty.
+template<typename Node>
+Node* findMax(Node* node) {
+    if (!node) return nullptr;
+    while (node->right)
+        node = node->right;
+    return node;
+}
+
+/// Returns the in-order successor of a node, or null for the last one.
+template<typename Node>
+Node* successor(Node* node) {
+    if (node->right)
+        return findMin(node->right);
+    Node* parent = node->parent;
+    while (parent && node == parent->right) {
+        node = parent;
+        parent = parent->parent;
+    }
+    return parent;
+}
+
+/// Returns the in-order predecessor of a node, or null for the first one.
+template<typename Node>
+Node* predecessor(Node* node) {
+    if (node->left)
+        return findMax(node->left);
+    Node* parent = node->parent;
+    while (parent && node == parent->left) {
+        node = parent;
+        parent = parent->parent;
+    }
+    return parent;
+}
+
+/**
+ * @brief Bidirectional in-order iterator over a tree of @p Node.
+ *
+ * Holds only the current node (null at end()) and the address of the
+ * owner's root pointer, and steps through parent pointers, so iterating
+ * never allocates and comparing two iterators is O(1). Decrementing end()
+ * yields the largest element. Insertions and removals of other elements do
+ * not invalidate it.
+ *
+ * @tparam Const True for const_iterator.
+ */
+template<typename Node, bool Const>
+class TreeIterator {
+    using Data = decltype(Node::data);
+
+public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type        = Data;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = typename std::conditional<Const, const Data*, Data*>::type;
+    using reference         = typename std::conditional<Const, const Data&, Data&>::type;
+
+    /// Constructs a singular iterator.
+    TreeIterator() : node_(nullptr), root_(nullptr) {}
+
+    /// Converts an iterator to a const_iterator.
+    template<bool C = Const, typename = typename std::enable_if<C>::type>
+    TreeIterator(const TreeIterator<Node, false>& other) : node_(other.node_), root_(other.root_) {}
+
+    /// Dereferences the iterator. Do not modify the ordering key of the element.
+    reference operator*() const { return node_->data; }
+    /// Access operator.
+    pointer operator->() const { return &node_->data; }
+
+    /// Prefix increment operator.
+    TreeIterator& operator++() { node_ = successor(node_); return *this; }
+    /// Postfix increment operator.
+    TreeIterator operator++(int) { TreeIterator temp = *this; ++(*this); return temp; }
+
+    /// Prefix decrement operator; decrementing end() yields the last element.
+    TreeIterator& operator--() {
+        node_ = node_ ? predecessor(node_) : findMax(*root_);
+        return *this;
+    }
+    /// Postfix decrement operator.
+    TreeIterator operator--(int) { TreeIterator temp = *this; --(*this); return temp; }
+
+    /// Equality comparison operator.
+    bool operator==(const TreeIterator& other) const { return node_ == other.node_; }
+    /// Inequality comparison operator.
+    bool operator!=(const TreeIterator& other) const { return node_ != other.node_; }
+
+private:
+    TreeIterator(Node* node, Node* const* root) : node_(node), root_(root) {}
+
+    Node* node_;        ///< Current node; null at end().
+    Node* const* root_; ///< Owner's root pointer, used to step back from end().
+
+    template<typename, typename> friend class dsa::BinarySearchTree;
+    template<typename, typename, typename, typename> friend class dsa::TreeMap;
+    friend class TreeIterator<Node, !Const>;
+};
+
+/// Replaces the subtree rooted at u with the one rooted at v.
+template<typename Node>
+void transplant(Node*& root, Node* u, Node* v) {
+    replaceChild(root, u->parent, u, v);
+    if (v)
+        v->parent = u->parent;
+}
+
+/**
+ * @brief Finds the node whose key is equivalent to @p key.
+ *
+ * On a miss, sets @p parent and @p link to the null link where such a node
+ * would be attached; on a hit their values are unspecified.
+ */
+template<typename KeyOf, typename Node, typename K, typename Compare>
+Node* descend(Node* const& root, const K& key, const Compare& comp, Node*& parent, Node**& link) {
+    parent = nullptr;
+    link = const_cast<Node**>(&root);
+    while (*link) {
+        Node* node = *link;
+        if (comp(key, KeyOf::get(node))) {
+            parent = node;
+            link = &node->left;
+        } else if (comp(KeyOf::get(node), key)) {
+            parent = node;
+            link = &node->right;
+        } else {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+/// Links a fresh leaf at @p link below @p parent and lets Balance repair the tree.
+template<typename Balance, typename Node>
+void attach(Node*& root, Node* node, Node* parent, Node** link) {
+    node->parent = parent;
+    *link = node;
+    for (Node* p = parent; p; p = p->parent)
+        ++p->size;
+    Balance::afterInsert(root, node);
+}
+
+/// Returns the node whose key is equivalent to @p key, or null.
+template<typename KeyOf, typename Node, typename K, typename Compare>
+Node* findNode(Node* node, const K& key, const Compare& comp) {
+    while (node) {
+        if (comp(key, KeyOf::get(node)))
+            node = node->left;
+        else if (comp(KeyOf::get(node), key))
+            node = node->right;
+        else
+            return node;
+    }
+    return nullptr;
+}
+
+/// Returns the first node whose key is not less than @p key, or null.
+template<typename KeyOf, typename Node, typename K, typename Compare>
+Node* lowerBoundNode(Node* node, const K& key, const Compare& comp) {
+    Node* best = nullptr;
+    while (node) {
+        if (comp(KeyOf::get(node), key)) {
+            node = node->right;
+        } else {
+            best = node;
+            node = node->left;
+        }
+    }
+    return best;
+}
+
+/// Returns the first node whose key is greater than @p key, or null.
+template<typename KeyOf, typename Node, typename K, typename Compare>
+Node* upperBoundNode(Node* node, const K& key, const Compare& comp) {
+    Node* best = nullptr;
+    while (node) {
+        if (comp(key, KeyOf::get(node))) {
+            best = node;
+            node = node->left;
+        } else {
+            node = node->right;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief Unlinks and deletes @p node, then lets Balance repair the tree.
+ *
+ * A node with two children is replaced by relinking its in-order successor
+ * rather than copying data, so iterators to every other node stay valid.
+ */
+template<typename Balance, typename Node>
+void eraseNode(Node*& root, Node* node) {
+    Node* x;        // Node that moves into the vacated position.
+    Node* xParent;  // Its new parent.
+    int removedTag; // Tag of the position that disappears.
+
+    if (!node->left || !node->right) {
+        // Zero or one child: splice the node out.
+        x = node->left ? node->left : node->right;
+        xParent = node->parent;
+        removedTag = node->tag;
+        transplant(root, node, x);
+    } else {
+        Node* succ = findMin(node->right);
+        removedTag = succ->tag;
+        x = succ->right;
+        if (succ->parent == node) {
+            xParent = succ;
+        } else {
+            xParent = succ->parent;
+            transplant(root, succ, succ->right);
+            succ->right = node->right;
+            succ->right->parent = succ;
+        }
+        transplant(root, node, succ);
+        succ->left = node->left;
+        succ->left->parent = succ;
+        succ->tag = node->tag;
+    }
+    delete node;
+    // Only the ancestors of the vacated position lost a descendant.
+    for (Node* p = xParent; p; p = p->parent)
+        updateSize(p);
+    Balance::afterErase(root, x, xParent, removedTag);
+}
+
+/// Frees a subtree in O(1) extra space by rotating left children up.
+template<typename Node>
+void destroyTree(Node* node) {
+    // Rotate each left child above its parent until the current node has no
+    // left child; then it can be freed and its right subtree processed.
+    while (node) {
+        if (node->left) {
+            Node* left = node->left;
+            node->left = left->right;
+            left->right = node;
+            node = left;
+        } else {
+            Node* right = node->right;
+            delete node;
+            node = right;
+        }
+    }
+}
+
+/// Copies a subtree in O(1) extra space, walking it via parent pointers.
+template<typename Node>
+Node* cloneTree(const Node* node) {
+    if (!node) return nullptr;
+    Node* copy = new Node(node->data);
+    copy->size = node->size;
+    copy->tag = node->tag;
+    // Pre-order walk that moves the source and copy cursors in lockstep.
+    const Node* src = node;
+    Node* dst = copy;
+    try {
+        while (true) {
+            Node** link = nullptr;
+            const Node* next = nullptr;
+            if (src->left && !dst->left) {
+                link = &dst->left;
+                next = src->left;
+            } else if (src->right && !dst->right) {
+                link = &dst->right;
+                next = src->right;
+            }
+            if (next) {
+                *link = new Node(next->data);
+                (*link)->size = next->size;
+                (*link)->tag = next->tag;
+                (*link)->parent = dst;
+                src = next;
+                dst = *link;
+            } else if (src == node) {
+                break;
+            } else {
+                src = src->parent;
+                dst = dst->parent;
+            }
+        }
+    } catch (...) {
+        destroyTree(copy);
+        throw;
+    }
+    return copy;
+}
+
+} // namespace detail
+
+} // namespace dsa
+
+#endif // DSA_TREENODEOPS_HPP
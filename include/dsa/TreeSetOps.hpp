@@ -0,0 +1,305 @@
+/**
+ * @file TreeSetOps.hpp
+ * @brief Join-based union, intersection and difference of AVL trees.
+ *
+ * Every algorithm is built from two primitives on AVL trees:
+ * - join(L, k, R) links two trees whose keys are separated by k, in time
+ *   proportional to their height difference;
+ * - split(T, k) cuts a tree into the keys below and above k.
+ * For example, union(A, B) splits B by A's root key, recursively unites the
+ * two halves with A's subtrees, and joins the results. The two recursive
+ * calls touch disjoint nodes, so they run as parallel tasks.
+ *
+ * The operations take their inputs by value and reuse their nodes, so
+ * passing trees with std::move performs no copying at all.
+ *
+ * @section Complexity
+ * For sizes m <= n:
+ * - Work: O(m log(n/m + 1))
+ * - Span: O(log^2 n) given enough threads
+ *
+ * @section Example
+ * @code
+ * dsa::AVLTree<int> a = ..., b = ...;
+ * dsa::AVLTree<int> both = dsa::set_union(std::move(a), std::move(b), 8);
+ * @endcode
+ */
+
+#ifndef DSA_TREESETOPS_HPP
+#define DSA_TREESETOPS_HPP
+
+#include <cstddef>
+#include <future>
+#include <utility>
+#include "Tree.hpp"
+
+namespace dsa {
+
+namespace detail {
+
+/**
+ * @struct TreeJoin
+ * @brief Split/join primitives and set algorithms on AVL-tagged TreeNodes.
+ *
+ * Node tags hold subtree heights, as maintained by AVLBalance.
+ */
+template<typename T>
+struct TreeJoin {
+    using Node = TreeNode<T>;
+    using Tree = BinarySearchTree<T, AVLBalance>;
+
+    /// Inputs smaller than this are processed without spawning tasks.
+    static constexpr std::size_t parallelGrain = 1 << 12;
+
+    static Node*& root(Tree& tree) { return tree.root_; }
+
+    static int height(const Node* n) { return n ? n->tag : 0; }
+
+    /// Makes k the parent of l and r and recomputes its height and size.
+    static Node* link(Node* l, Node* k, Node* r) {
+        k->left = l;
+        k->right = r;
+        k->parent = nullptr;
+        if (l)
+            l->parent = k;
+        if (r)
+            r->parent = k;
+        int hl = height(l), hr = height(r);
+        k->tag = 1 + (hl > hr ? hl : hr);
+        detail::updateSize(k);
+        return k;
+    }
+
+    static Node* rotateLeft(Node* x) {
+        Node* y = x->right;
+        return link(link(x->left, x, y->left), y, y->right);
+    }
+
+    static Node* rotateRight(Node* x) {
+        Node* y = x->left;
+        return link(y->left, y, link(y->right, x, x->right));
+    }
+
+    /// Joins when l is taller: walks down l's right spine to attach r.
+    static Node* joinRight(Node* l, Node* k, Node* r) {
+        Node* c = l->right;
+        if (height(c) <= height(r) + 1) {
+            Node* t = link(c, k, r);
+            if (height(t) <= height(l->left) + 1)
+                return link(l->left, l, t);
+            return rotateLeft(link(l->left, l, rotateRight(t)));
+        }
+        Node* t = joinRight(c, k, r);
+        Node* result = link(l->left, l, t);
+        if (height(t) <= height(l->left) + 1)
+            return result;
+        return rotateLeft(result);
+    }
+
+    /// Mirror image of joinRight().
+    static Node* joinLeft(Node* l, Node* k, Node* r) {
+        Node* c = r->left;
+        if (height(c) <= height(l) + 1) {
+            Node* t = link(l, k, c);
+            if (height(t) <= height(r->right) + 1)
+                return link(t, r, r->right);
+            return rotateRight(link(rotateLeft(t), r, r->right));
+        }
+        Node* t = joinLeft(l, k, c);
+        Node* result = link(t, r, r->right);
+        if (height(t) <= height(r->right) + 1)
+            return result;
+        return rotateRight(result);
+    }
+
+    /// Joins l, k and r, where every key of l < k < every key of r.
+    static Node* join(Node* l, Node* k, Node* r) {
+        if (height(l) > height(r) + 1)
+            return joinRight(l, k, r);
+        if (height(r) > height(l) + 1)
+            return joinLeft(l, k, r);
+        return link(l, k, r);
+    }
+
+    /// Removes the maximum of t into @p last; returns the remaining tree.
+    static Node* splitLast(Node* t, Node*& last) {
+        if (!t->right) {
+            last = t;
+            if (t->left)
+                t->left->parent = nullptr;
+            return t->left;
+        }
+        Node* rest = splitLast(t->right, last);
+        return join(t->left, t, rest);
+    }
+
+    /// Joins two trees where every key of l < every key of r.
+    static Node* join2(Node* l, Node* r) {
+        if (!l)
+            return r;
+        Node* last;
+        Node* rest = splitLast(l, last);
+        return join(rest, last, r);
+    }
+
+    /// Splits t into keys < key (l) and > key (r); an equal node goes to @p match.
+    static void split(Node* t, const T& key, Node*& l, Node*& match, Node*& r) {
+        if (!t) {
+            l = match = r = nullptr;
+            return;
+        }
+        Node* left = t->left;
+        Node* right = t->right;
+        if (key < t->data) {
+            Node* rl;
+            split(left, key, l, match, rl);
+            r = join(rl, t, right);
+        } else if (t->data < key) {
+            Node* lr;
+            split(right, key, lr, match, r);
+            l = join(left, t, lr);
+        } else {
+            if (left)
+                left->parent = nullptr;
+            if (right)
+                right->parent = nullptr;
+            l = left;
+            match = t;
+            r = right;
+        }
+    }
+
+    /// Frees a detached subtree.
+    static void discard(Node* t) {
+        destroyTree(t);
+    }
+
+    /// Runs a(), b() as parallel tasks when worthwhile, otherwise in sequence.
+    template<typename A, typename B>
+    static void both(std::size_t work, unsigned threads, A a, B b) {
+        if (threads > 1 && work >= parallelGrain) {
+            auto left = std::async(std::launch::async, a);
+            b();
+            left.get();
+        } else {
+            a();
+            b();
+        }
+    }
+
+    static Node* unite(Node* a, Node* b, unsigned threads) {
+        if (!a)
+            return b;
+        if (!b)
+            return a;
+        Node *bl, *dup, *br;
+        split(b, a->data, bl, dup, br);
+        if (dup)
+            delete dup;
+        Node* al = a->left;
+        Node* ar = a->right;
+        Node *l, *r;
+        unsigned half = threads / 2;
+        both(a->size + detail::subtreeSize(bl) + detail::subtreeSize(br), threads,
+             [&] { l = unite(al, bl, half); },
+             [&] { r = unite(ar, br, threads - half); });
+        return join(l, a, r);
+    }
+
+    static Node* intersect(Node* a, Node* b, unsigned threads) {
+        if (!a || !b) {
+            discard(a);
+            discard(b);
+            return nullptr;
+        }
+        Node *bl, *match, *br;
+        split(b, a->data, bl, match, br);
+        Node* al = a->left;
+        Node* ar = a->right;
+        Node *l, *r;
+        unsigned half = threads / 2;
+        both(a->size + detail::subtreeSize(bl) + detail::subtreeSize(br), threads,
+             [&] { l = intersect(al, bl, half); },
+             [&] { r = intersect(ar, br, threads - half); });
+        if (match) {
+            delete match;
+            return join(l, a, r);
+        }
+        delete a;
+        return join2(l, r);
+    }
+
+    static Node* subtract(Node* a, Node* b, unsigned threads) {
+        if (!a || !b) {
+            discard(b);
+            return a;
+        }
+        Node *al, *match, *ar;
+        split(a, b->data, al, match, ar);
+        Node* bl = b->left;
+        Node* br = b->right;
+        Node *l, *r;
+        unsigned half = threads / 2;
+        both(b->size + detail::subtreeSize(al) + detail::subtreeSize(ar), threads,
+             [&] { l = subtract(al, bl, half); },
+             [&] { r = subtract(ar, br, threads - half); });
+        delete b;
+        if (match)
+            delete match;
+        return join2(l, r);
+    }
+
+    /// Runs op on the roots of a and b and wraps the result in a tree.
+    template<typename Op>
+    static Tree apply(Tree a, Tree b, Op op) {
+        Node* ra = root(a);
+        Node* rb = root(b);
+        root(a) = nullptr;
+        root(b) = nullptr;
+        Tree result;
+        root(result) = op(ra, rb);
+        return result;
+    }
+};
+
+} // namespace detail
+
+/**
+ * @brief Returns the elements that are in @p a or in @p b.
+ * @param a First set; pass with std::move to avoid a copy.
+ * @param b Second set; pass with std::move to avoid a copy.
+ * @param threads Maximum number of concurrent tasks; 1 runs serially.
+ */
+template<typename T>
+AVLTree<T> set_union(AVLTree<T> a, AVLTree<T> b, unsigned threads = 1) {
+    return detail::TreeJoin<T>::apply(std::move(a), std::move(b),
+        [threads](TreeNode<T>* x, TreeNode<T>* y) { return detail::TreeJoin<T>::unite(x, y, threads); });
+}
+
+/**
+ * @brief Returns the elements that are in both @p a and @p b.
+ * @param a First set; pass with std::move to avoid a copy.
+ * @param b Second set; pass with std::move to avoid a copy.
+ * @param threads Maximum number of concurrent tasks; 1 runs serially.
+ */
+template<typename T>
+AVLTree<T> set_intersection(AVLTree<T> a, AVLTree<T> b, unsigned threads = 1) {
+    return detail::TreeJoin<T>::apply(std::move(a), std::move(b),
+        [threads](TreeNode<T>* x, TreeNode<T>* y) { return detail::TreeJoin<T>::intersect(x, y, threads); });
+}
+
+/**
+ * @brief Returns the elements of @p a that are not in @p b.
+ * @param a Set to subtract from; pass with std::move to avoid a copy.
+ * @param b Set of elements to remove; pass with std::move to avoid a copy.
+ * @param threads Maximum number of concurrent tasks; 1 runs serially.
+ */
+template<typename T>
+AVLTree<T> set_difference(AVLTree<T> a, AVLTree<T> b, unsigned threads = 1) {
+    return detail::TreeJoin<T>::apply(std::move(a), std::move(b),
+        [threads](TreeNode<T>* x, TreeNode<T>* y) { return detail::TreeJoin<T>::subtract(x, y, threads); });
+}
+
+} // namespace dsa
+
+#endif // DSA_TREESETOPS_HPP
@@ -1,6 +1,6 @@
 /**
  * @file Utilities.hpp
- * @brief Provides utility functions for debugging.
+ * @brief Provides utility functions for debugging and shared constants.
  */
 
  #ifndef DSA_UTILITIES_HPP
@@ -8,10 +8,19 @@
  
  #include <iostream>
  #include <chrono>
+ #include <cstddef>
  #include <string>
  
  namespace dsa {
  
+ /**
+  * @brief Assumed size of a CPU cache line in bytes.
+  *
+  * Used to keep independently written members of concurrent containers on
+  * separate cache lines.
+  */
+ inline constexpr std::size_t cacheLineSize = 64;
+ 
  /**
   * @brief Prints a separator line.
   */
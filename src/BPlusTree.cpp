@@ -0,0 +1,10 @@
+/**
+ * @file BPlusTree.cpp
+ * @brief Implements the BPlusTree class template.
+ */
+
+#include "dsa/BPlusTree.hpp"
+
+namespace dsa {
+    template class BPlusTree<int, int>;
+}
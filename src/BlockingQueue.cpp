@@ -0,0 +1,10 @@
+/**
+ * @file BlockingQueue.cpp
+ * @brief Implements the BlockingQueue class template.
+ */
+
+#include "dsa/BlockingQueue.hpp"
+
+namespace dsa {
+    template class BlockingQueue<int>;
+}
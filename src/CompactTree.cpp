@@ -0,0 +1,10 @@
+/**
+ * @file CompactTree.cpp
+ * @brief Implements the CompactTree class template.
+ */
+
+#include "dsa/CompactTree.hpp"
+
+namespace dsa {
+    template class CompactTree<int>;
+}
@@ -0,0 +1,12 @@
+/**
+ * @file ConcurrentHashMap.cpp
+ * @brief Implements the ConcurrentHashMap class template.
+ */
+
+#include "dsa/ConcurrentHashMap.hpp"
+#include <string>
+
+namespace dsa {
+    template class ConcurrentHashMap<std::string, int>;
+    template class ConcurrentHashMap<int, int, SwissTable>;
+}
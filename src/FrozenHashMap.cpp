@@ -0,0 +1,12 @@
+/**
+ * @file FrozenHashMap.cpp
+ * @brief Implements the FrozenHashMap class template.
+ */
+
+#include "dsa/FrozenHashMap.hpp"
+#include <string>
+
+namespace dsa {
+    template class FrozenHashMap<std::string, int>;
+    template class FrozenHashMap<int, int>;
+}
@@ -0,0 +1,10 @@
+/**
+ * @file FrozenSearchTree.cpp
+ * @brief Implements the FrozenSearchTree class template.
+ */
+
+#include "dsa/FrozenSearchTree.hpp"
+
+namespace dsa {
+    template class FrozenSearchTree<int>;
+}
@@ -9,5 +9,7 @@
  namespace dsa {
      // Explicit instantiation for HashMap with <std::string, int>
      template class HashMap<std::string, int>;
+     template class HashMap<std::string, int, SwissTable>;
+     template class HashMap<std::string, int, RobinHood>;
  }
  
\ No newline at end of file
@@ -0,0 +1,10 @@
+/**
+ * @file MPMCQueue.cpp
+ * @brief Implements the MPMCQueue class template.
+ */
+
+#include "dsa/MPMCQueue.hpp"
+
+namespace dsa {
+    template class MPMCQueue<int>;
+}
@@ -0,0 +1,10 @@
+/**
+ * @file PersistentTree.cpp
+ * @brief Implements the PersistentTree class template.
+ */
+
+#include "dsa/PersistentTree.hpp"
+
+namespace dsa {
+    template class PersistentTree<int>;
+}
@@ -0,0 +1,11 @@
+/**
+ * @file PriorityQueue.cpp
+ * @brief Implements the PriorityQueue and IndexedPriorityQueue class templates.
+ */
+
+#include "dsa/PriorityQueue.hpp"
+
+namespace dsa {
+    template class PriorityQueue<int>;
+    template class IndexedPriorityQueue<int>;
+}
@@ -0,0 +1,10 @@
+/**
+ * @file SPSCQueue.cpp
+ * @brief Implements the SPSCQueue class template.
+ */
+
+#include "dsa/SPSCQueue.hpp"
+
+namespace dsa {
+    template class SPSCQueue<int>;
+}
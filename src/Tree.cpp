@@ -7,5 +7,7 @@
 
  namespace dsa {
      template class BinarySearchTree<int>;
+     template class BinarySearchTree<int, AVLBalance>;
+     template class BinarySearchTree<int, RedBlackBalance>;
+     template class BinarySearchTree<int, TreapBalance>;
  }
- 
\ No newline at end of file
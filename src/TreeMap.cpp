@@ -0,0 +1,10 @@
+/**
+ * @file TreeMap.cpp
+ * @brief Implements the TreeMap class template.
+ */
+
+#include "dsa/TreeMap.hpp"
+
+namespace dsa {
+    template class TreeMap<int, int>;
+}
@@ -0,0 +1,13 @@
+/**
+ * @file TreeSetOps.cpp
+ * @brief Instantiates the join-based set operations.
+ */
+
+#include "dsa/TreeSetOps.hpp"
+
+namespace dsa {
+    template struct detail::TreeJoin<int>;
+    template AVLTree<int> set_union<int>(AVLTree<int>, AVLTree<int>, unsigned);
+    template AVLTree<int> set_intersection<int>(AVLTree<int>, AVLTree<int>, unsigned);
+    template AVLTree<int> set_difference<int>(AVLTree<int>, AVLTree<int>, unsigned);
+}
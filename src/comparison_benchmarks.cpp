@@ -16,6 +16,7 @@
 #include "dsa/Stack.hpp"
 #include "dsa/Queue.hpp"
 #include "dsa/Tree.hpp"
+#include "dsa/BPlusTree.hpp"
 #include "dsa/HashMap.hpp"
 #include "dsa/Graph.hpp"
 
@@ -295,6 +296,118 @@ void compareTreeAndMap(int size) {
     std::cout << "  Ratio (DSA/STL): " << std::fixed << std::setprecision(2) << dsa_time / stl_time << "x\n\n";
 }
 
+// BPlusTree vs BinarySearchTree vs std::map benchmark
+void compareBPlusTreeAndMap(int size) {
+    std::cout << "=== BPlusTree vs BinarySearchTree vs std::map (size = " << size << ") ===\n";
+    
+    // Random keys for insertion
+    std::vector<int> values(size);
+    for (int i = 0; i < size; i++) {
+        values[i] = rand() % (size * 10);
+    }
+    
+    // Insert Operation
+    double bpt_time = measureTime([&]() {
+        dsa::BPlusTree<int, int> tree;
+        for (int i = 0; i < size; i++) {
+            tree.insert(values[i], i);
+        }
+    });
+    
+    double bst_time = measureTime([&]() {
+        dsa::BinarySearchTree<int> tree;
+        for (int i = 0; i < size; i++) {
+            tree.insert(values[i]);
+        }
+    });
+    
+    double stl_time = measureTime([&]() {
+        std::map<int, int> map;
+        for (int i = 0; i < size; i++) {
+            map[values[i]] = i;
+        }
+    });
+    
+    std::cout << "Insert operation:\n";
+    std::cout << "  BPlusTree:        " << std::fixed << std::setprecision(3) << bpt_time << " ms\n";
+    std::cout << "  BinarySearchTree: " << std::fixed << std::setprecision(3) << bst_time << " ms\n";
+    std::cout << "  std::map:         " << std::fixed << std::setprecision(3) << stl_time << " ms\n";
+    std::cout << "  Ratio (B+/STL): " << std::fixed << std::setprecision(2) << bpt_time / stl_time << "x\n\n";
+    
+    // Search Operation
+    dsa::BPlusTree<int, int> bpt_tree;
+    dsa::BinarySearchTree<int> dsa_tree;
+    std::map<int, int> stl_map;
+    
+    for (int i = 0; i < size; i++) {
+        bpt_tree.insert(values[i], i);
+        dsa_tree.insert(values[i]);
+        stl_map[values[i]] = i;
+    }
+    
+    std::size_t hits = 0;
+    bpt_time = measureTime([&]() {
+        for (int i = 0; i < size; i++) {
+            hits += bpt_tree.contains(values[i]);
+        }
+    });
+    
+    bst_time = measureTime([&]() {
+        for (int i = 0; i < size; i++) {
+            hits += dsa_tree.search(values[i]);
+        }
+    });
+    
+    stl_time = measureTime([&]() {
+        for (int i = 0; i < size; i++) {
+            hits += stl_map.find(values[i]) != stl_map.end();
+        }
+    });
+    
+    std::cout << "Search operation (" << hits << " hits):\n";
+    std::cout << "  BPlusTree:        " << std::fixed << std::setprecision(3) << bpt_time << " ms\n";
+    std::cout << "  BinarySearchTree: " << std::fixed << std::setprecision(3) << bst_time << " ms\n";
+    std::cout << "  std::map:         " << std::fixed << std::setprecision(3) << stl_time << " ms\n";
+    std::cout << "  Ratio (B+/STL): " << std::fixed << std::setprecision(2) << bpt_time / stl_time << "x\n\n";
+    
+    // Range Scan Operation: 100 scans, each over a tenth of the key space
+    const int scans = 100;
+    const int width = size;
+    long long sum = 0;
+    
+    bpt_time = measureTime([&]() {
+        for (int s = 0; s < scans; s++) {
+            int lo = values[s % size];
+            bpt_tree.scan(lo, lo + width, [&](int, int v) { sum += v; });
+        }
+    });
+    
+    bst_time = measureTime([&]() {
+        for (int s = 0; s < scans; s++) {
+            int lo = values[s % size];
+            for (int key : dsa_tree.range(lo, lo + width)) {
+                sum += key;
+            }
+        }
+    });
+    
+    stl_time = measureTime([&]() {
+        for (int s = 0; s < scans; s++) {
+            int lo = values[s % size];
+            auto end = stl_map.lower_bound(lo + width);
+            for (auto it = stl_map.lower_bound(lo); it != end; ++it) {
+                sum += it->second;
+            }
+        }
+    });
+    
+    std::cout << "Range scan operation (checksum " << sum << "):\n";
+    std::cout << "  BPlusTree:        " << std::fixed << std::setprecision(3) << bpt_time << " ms\n";
+    std::cout << "  BinarySearchTree: " << std::fixed << std::setprecision(3) << bst_time << " ms\n";
+    std::cout << "  std::map:         " << std::fixed << std::setprecision(3) << stl_time << " ms\n";
+    std::cout << "  Ratio (B+/STL): " << std::fixed << std::setprecision(2) << bpt_time / stl_time << "x\n\n";
+}
+
 // HashMap vs unordered_map benchmark
 void compareHashMapAndUnorderedMap(int size) {
     std::cout << "=== HashMap vs std::unordered_map (size = " << size << ") ===\n";
@@ -314,6 +427,13 @@ void compareHashMapAndUnorderedMap(int size) {
         }
     });
     
+    double swiss_time = measureTime([&]() {
+        dsa::SwissHashMap<std::string, int> hashmap;
+        for (int i = 0; i < size; i++) {
+            hashmap.put(keys[i], i);
+        }
+    });
+    
     double stl_time = measureTime([&]() {
         std::unordered_map<std::string, int> hashmap;
         for (int i = 0; i < size; i++) {
@@ -323,16 +443,19 @@ void compareHashMapAndUnorderedMap(int size) {
     
     std::cout << "Insert operation:\n";
     std::cout << "  HashMap:            " << std::fixed << std::setprecision(3) << dsa_time << " ms\n";
+    std::cout << "  SwissHashMap:       " << std::fixed << std::setprecision(3) << swiss_time << " ms\n";
     std::cout << "  std::unordered_map: " << std::fixed << std::setprecision(3) << stl_time << " ms\n";
     std::cout << "  Ratio (DSA/STL): " << std::fixed << std::setprecision(2) << dsa_time / stl_time << "x\n\n";
     
     // Get/Find Operation
     // First create populated structures
     dsa::HashMap<std::string, int> dsa_map;
+    dsa::SwissHashMap<std::string, int> swiss_map;
     std::unordered_map<std::string, int> stl_map;
     
     for (int i = 0; i < size; i++) {
         dsa_map.put(keys[i], i);
+        swiss_map.put(keys[i], i);
         stl_map[keys[i]] = i;
     }
     
@@ -344,6 +467,13 @@ void compareHashMapAndUnorderedMap(int size) {
         }
     });
     
+    swiss_time = measureTime([&]() {
+        int value;
+        for (int i = 0; i < size; i++) {
+            swiss_map.get(keys[i % size], value);
+        }
+    });
+    
     stl_time = measureTime([&]() {
         for (int i = 0; i < size; i++) {
             volatile auto it = stl_map.find(keys[i % size]);
@@ -352,6 +482,7 @@ void compareHashMapAndUnorderedMap(int size) {
     
     std::cout << "Lookup operation:\n";
     std::cout << "  HashMap:            " << std::fixed << std::setprecision(3) << dsa_time << " ms\n";
+    std::cout << "  SwissHashMap:       " << std::fixed << std::setprecision(3) << swiss_time << " ms\n";
     std::cout << "  std::unordered_map: " << std::fixed << std::setprecision(3) << stl_time << " ms\n";
     std::cout << "  Ratio (DSA/STL): " << std::fixed << std::setprecision(2) << dsa_time / stl_time << "x\n\n";
 }
@@ -374,6 +505,7 @@ void runComparisons() {
     compareStackAndStdStack(small_size);
     compareQueueAndStdQueue(small_size);
     compareTreeAndMap(small_size);
+    compareBPlusTreeAndMap(small_size);
     compareHashMapAndUnorderedMap(small_size);
     
     // Medium size (10^4)
@@ -385,6 +517,7 @@ void runComparisons() {
     compareStackAndStdStack(medium_size);
     compareQueueAndStdQueue(medium_size);
     compareTreeAndMap(medium_size);
+    compareBPlusTreeAndMap(medium_size);
     compareHashMapAndUnorderedMap(medium_size);
     
     // Large size (10^5)
@@ -401,6 +534,7 @@ void runComparisons() {
     std::cout << "\nLARGE SIZE COMPARISONS FOR TREE & HASHMAP (n = " << smaller_size << ")\n";
     std::cout << "------------------------------------------\n";
     compareTreeAndMap(smaller_size);
+    compareBPlusTreeAndMap(smaller_size);
     compareHashMapAndUnorderedMap(smaller_size);
     
     std::cout << "\n==========================================\n";
@@ -414,6 +548,7 @@ void runComparisons() {
     std::cout << "- LinkedList vs std::list: Tests link manipulation efficiency\n";
     std::cout << "- Stack/Queue vs STL counterparts: Tests LIFO/FIFO operations\n";
     std::cout << "- BinarySearchTree vs std::map: Compares binary tree implementations\n";
+    std::cout << "- BPlusTree vs std::map: Shows the effect of cache-line sized nodes\n";
     std::cout << "- HashMap vs std::unordered_map: Tests hashing approach differences\n\n";
     std::cout << "Remember that STL implementations are highly optimized.\n";
     std::cout << "Your implementations prioritize clarity and learning.\n";
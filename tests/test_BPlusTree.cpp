@@ -0,0 +1,126 @@
+/**
+ * @file test_BPlusTree.cpp
+ * @brief Tests the BPlusTree class.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "dsa/BPlusTree.hpp"
+
+// Checks size, in-order iteration and lookups against a reference map.
+template<typename Tree>
+bool matches(const Tree& tree, const std::map<int, int>& ref) {
+    if (tree.size() != ref.size())
+        return false;
+    auto it = tree.begin();
+    for (const auto& entry : ref) {
+        if (it == tree.end() || it.key() != entry.first || it.value() != entry.second)
+            return false;
+        const int* found = tree.find(entry.first);
+        if (!found || *found != entry.second)
+            return false;
+        ++it;
+    }
+    return it == tree.end();
+}
+
+int main() {
+    // Smallest nodes so that splits, borrows and merges happen constantly.
+    using SmallTree = dsa::BPlusTree<int, int, 64>;
+    SmallTree tree;
+    std::map<int, int> ref;
+    std::mt19937 rng(12345);
+    for (int round = 0; round < 20000; ++round) {
+        int key = static_cast<int>(rng() % 2000);
+        if (rng() % 3 != 0) {
+            bool inserted = tree.insert(key, round);
+            bool expected = ref.find(key) == ref.end();
+            ref[key] = round;
+            assert(inserted == expected);
+        } else {
+            bool removed = tree.remove(key);
+            bool expected = ref.erase(key) == 1;
+            assert(removed == expected);
+        }
+    }
+    assert(matches(tree, ref));
+
+    // Range scans follow the leaf links.
+    int lo = 500, hi = 900;
+    auto refIt = ref.lower_bound(lo);
+    bool inOrder = true;
+    std::size_t visited = tree.scan(lo, hi, [&](int key, int value) {
+        inOrder = inOrder && refIt != ref.end() && refIt->first == key && refIt->second == value;
+        ++refIt;
+    });
+    assert(inOrder);
+    assert(visited == static_cast<std::size_t>(std::distance(ref.lower_bound(lo), ref.lower_bound(hi))));
+    auto lb = tree.lower_bound(lo);
+    assert(lb != tree.end() && lb.key() == ref.lower_bound(lo)->first);
+    assert(tree.lower_bound(1 << 20) == tree.end());
+
+    // Values are writable only through a non-const tree.
+    static_assert(std::is_same<decltype(std::declval<const SmallTree&>().begin().value()), const int&>::value,
+                  "const_iterator must not expose mutable values");
+    lb.value() = -7;
+    const SmallTree& view = tree;
+    SmallTree::const_iterator clb = view.lower_bound(lo);
+    assert(clb == SmallTree::const_iterator(lb) && clb.value() == -7);
+    ref[lb.key()] = -7;
+
+    // Iterators work with range-for, structured bindings and algorithms.
+    long long keySum = 0;
+    for (auto [key, value] : view) {
+        keySum += key;
+        static_assert(std::is_same<decltype(value), const int&>::value, "const entries are read-only");
+    }
+    long long refSum = 0;
+    for (const auto& entry : ref)
+        refSum += entry.first;
+    assert(keySum == refSum);
+    for (auto [key, value] : tree)
+        value = key + 1;
+    auto odd = std::find_if(tree.begin(), tree.end(), [](auto entry) { return entry.second % 2 != 0; });
+    assert(odd != tree.end() && odd->first % 2 == 0 && odd->second == odd->first + 1);
+    assert(std::distance(view.begin(), view.end()) == static_cast<std::ptrdiff_t>(tree.size()));
+    SmallTree::iterator it;
+    it = tree.begin();
+    SmallTree::iterator first = it++;
+    assert(first == tree.begin() && it != first && (*first).first < it.key());
+    for (auto& entry : ref)
+        entry.second = entry.first + 1;
+
+    // Copies are deep; moves leave the source empty.
+    SmallTree copy = tree;
+    copy.insert(-1, 0);
+    assert(!tree.contains(-1) && copy.contains(-1));
+    assert(matches(tree, ref));
+    SmallTree moved = std::move(copy);
+    assert(copy.empty() && moved.size() == ref.size() + 1);
+
+    // Removing everything returns to the empty state.
+    for (const auto& entry : ref) {
+        bool removed = tree.remove(entry.first);
+        assert(removed);
+    }
+    assert(tree.empty() && tree.begin() == tree.end());
+    bool removedAbsent = tree.remove(0);
+    assert(!removedAbsent);
+
+    // Non-arithmetic keys use the branchless binary search.
+    dsa::BPlusTree<std::string, int> names;
+    names.insert("delta", 4);
+    names.insert("alpha", 1);
+    names.insert("charlie", 3);
+    names.insert("bravo", 2);
+    assert(names.begin().key() == "alpha");
+    assert(*names.find("charlie") == 3 && names.find("echo") == nullptr);
+    return 0;
+}
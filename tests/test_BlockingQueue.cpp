@@ -0,0 +1,56 @@
+/**
+ * @file test_BlockingQueue.cpp
+ * @brief Tests the BlockingQueue class.
+ */
+
+#include <cassert>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "dsa/BlockingQueue.hpp"
+
+int main() {
+    using namespace std::chrono;
+    dsa::BlockingQueue<int> queue;
+    int value = -1;
+
+    // Times out on an empty queue.
+    bool got = queue.pop_wait(value, milliseconds(10));
+    assert(!got);
+
+    for (int i = 0; i < 10; ++i)
+        queue.push(i);
+    got = queue.pop_wait(value, milliseconds(10));
+    assert(got && value == 0);
+    std::vector<int> batch;
+    std::size_t n = queue.drain_to(batch, 4);
+    assert(n == 4 && batch.size() == 4 && batch[0] == 1 && batch[3] == 4);
+    assert(queue.size() == 5);
+
+    // A parked consumer is woken by a producer on another thread.
+    dsa::BlockingQueue<int> handoff;
+    std::thread producer([&] {
+        std::this_thread::sleep_for(milliseconds(20));
+        handoff.push(42);
+    });
+    got = handoff.pop_wait(value, seconds(10));
+    producer.join();
+    assert(got && value == 42);
+
+    // close() wakes waiters, rejects pushes and still drains queued items.
+    std::thread closer([&] {
+        std::this_thread::sleep_for(milliseconds(20));
+        handoff.close();
+    });
+    got = handoff.pop_wait(value, seconds(10));
+    closer.join();
+    assert(!got && handoff.closed());
+    bool pushed = handoff.push(1);
+    assert(!pushed);
+    queue.close();
+    std::size_t drained = 0;
+    while (queue.pop_wait(value, seconds(10)))
+        ++drained;
+    assert(drained == 5 && queue.empty());
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file test_CompactTree.cpp
+ * @brief Tests the CompactTree class.
+ */
+
+#include <cassert>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+#include "dsa/CompactTree.hpp"
+
+// Checks a tree's contents against a reference set.
+template<typename Tree, typename Set>
+bool sameContents(const Tree& tree, const Set& expected) {
+    if (tree.size() != expected.size())
+        return false;
+    auto it = expected.begin();
+    for (const auto& v : tree) {
+        if (!(v == *it))
+            return false;
+        ++it;
+    }
+    return true;
+}
+
+int main() {
+    dsa::CompactTree<int> tree;
+    assert(tree.empty() && tree.begin() == tree.end());
+
+    // Sorted input stays balanced.
+    tree.reserve(3000);
+    for (int i = 0; i < 3000; ++i)
+        tree.insert(i);
+    assert(tree.size() == 3000 && tree.height() <= 17);
+    assert(tree.capacity() >= 3000);
+
+    // Random inserts and removes against std::set; removal keeps the pool dense.
+    std::set<int> reference;
+    for (int i = 0; i < 3000; ++i)
+        reference.insert(i);
+    std::srand(5);
+    for (int i = 0; i < 30000; ++i) {
+        int key = std::rand() % 5000;
+        if (std::rand() % 2) {
+            tree.insert(key);
+            reference.insert(key);
+        } else {
+            bool removed = tree.remove(key);
+            bool expected = reference.erase(key) == 1;
+            assert(removed == expected);
+        }
+    }
+    assert(tree.height() <= 17);
+    assert(sameContents(tree, reference));
+    assert(tree.search(*reference.begin()) && !tree.search(-1));
+
+    // Iterators are bidirectional.
+    auto last = tree.end();
+    --last;
+    assert(*last == *reference.rbegin());
+
+    // Copies are independent; moves leave the source empty.
+    dsa::CompactTree<int> copy = tree;
+    copy.insert(-1);
+    assert(!tree.search(-1) && copy.search(-1));
+    dsa::CompactTree<int> moved = std::move(copy);
+    assert(copy.empty() && copy.begin() == copy.end() && moved.search(-1));
+    copy.insert(7);
+    assert(copy.size() == 1);
+
+    // Draining the tree returns it to empty.
+    for (int v : reference) {
+        bool removed = tree.remove(v);
+        assert(removed);
+    }
+    assert(tree.empty() && tree.height() == 0);
+
+    // Non-trivial element types are moved between slots correctly.
+    dsa::CompactTree<std::string> words;
+    std::set<std::string> wordSet;
+    for (int i = 0; i < 200; ++i) {
+        std::string w = "w" + std::to_string((i * 7919) % 211);
+        words.insert(w);
+        wordSet.insert(w);
+    }
+    for (int i = 0; i < 211; i += 3) {
+        std::string w = "w" + std::to_string(i);
+        words.remove(w);
+        wordSet.erase(w);
+    }
+    assert(sameContents(words, wordSet));
+    return 0;
+}
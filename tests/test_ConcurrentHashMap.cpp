@@ -0,0 +1,73 @@
+/**
+ * @file test_ConcurrentHashMap.cpp
+ * @brief Tests the ConcurrentHashMap class.
+ */
+
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "dsa/ConcurrentHashMap.hpp"
+
+int main() {
+    dsa::ConcurrentHashMap<std::string, int> map(5);
+    assert(map.shard_count() == 8 && map.empty());
+    map.put("a", 1);
+    int value = 0;
+    bool found = map.get("a", value);
+    assert(found && value == 1 && map.contains(std::string_view("a")));
+    bool inserted = map.upsert("a", 10, [](int& v) { v += 5; });
+    assert(!inserted && map.get("a", value) && value == 6);
+    inserted = map.upsert("b", 10, [](int& v) { v += 5; });
+    assert(inserted && map.get("b", value) && value == 10);
+
+    // compute() inserts, updates and removes depending on its result.
+    bool present = map.compute("c", [](int& v, bool existed) { v = existed ? -1 : 7; return true; });
+    assert(present && map.get("c", value) && value == 7);
+    present = map.compute("c", [](int& v, bool) { return v != 7; });
+    assert(!present && !map.contains("c"));
+    present = map.compute("d", [](int&, bool) { return false; });
+    assert(!present && !map.contains("d") && map.size() == 2);
+    bool threw = false;
+    try {
+        map.compute("e", [](int&, bool) -> bool { throw std::runtime_error("fail"); });
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw && !map.contains("e"));
+    bool removed = map.remove("a");
+    bool again = map.remove("a");
+    assert(removed && !again && map.size() == 1);
+
+    // Concurrent upserts of shared counters lose no increments, and keys
+    // written by one thread each are all there afterwards.
+    dsa::ConcurrentHashMap<int, int> counts(16);
+    const int threads = 8;
+    const int rounds = 20000;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&counts, t] {
+            for (int i = 0; i < rounds; ++i) {
+                counts.upsert(i % 64, 1, [](int& v) { ++v; });
+                counts.put(1000 + t * rounds + i, i);
+                int seen;
+                if (counts.get(1000 + t * rounds + i / 2, seen))
+                    assert(seen == i / 2);
+            }
+        });
+    }
+    for (auto& worker : workers)
+        worker.join();
+    int total = 0;
+    for (int k = 0; k < 64; ++k) {
+        int v = 0;
+        bool ok = counts.get(k, v);
+        assert(ok);
+        total += v;
+    }
+    assert(total == threads * rounds);
+    assert(counts.size() == static_cast<std::size_t>(64 + threads * rounds));
+    return 0;
+}
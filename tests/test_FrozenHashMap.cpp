@@ -0,0 +1,128 @@
+/**
+ * @file test_FrozenHashMap.cpp
+ * @brief Tests the FrozenHashMap class.
+ */
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "dsa/FrozenHashMap.hpp"
+
+int main() {
+    // An empty map finds nothing.
+    dsa::FrozenHashMap<int, int> none;
+    int value = -1;
+    assert(none.empty() && none.find(3) == nullptr && !none.get(3, value));
+
+    // Built from a range: every key has one slot, absent keys miss.
+    std::vector<std::pair<int, int>> pairs;
+    for (int i = 0; i < 100000; ++i)
+        pairs.emplace_back(i * 7 + 1, i);
+    dsa::FrozenHashMap<int, int> numbers(pairs.begin(), pairs.end());
+    assert(numbers.size() == pairs.size());
+    for (const auto& entry : pairs) {
+        const int* found = numbers.find(entry.first);
+        assert(found && *found == entry.second);
+    }
+    for (int i = 0; i < 100000; ++i)
+        assert(!numbers.contains(i * 7 + 3));
+    assert(numbers.bits_per_key() > 3.0 && numbers.bits_per_key() < 4.0);
+
+    // Small sets, down to a single key.
+    for (int n = 1; n < 40; ++n) {
+        std::vector<std::pair<int, int>> few;
+        for (int i = 0; i < n; ++i)
+            few.emplace_back(i * 1000, -i);
+        dsa::FrozenHashMap<int, int> small(few.begin(), few.end());
+        for (int i = 0; i < n; ++i)
+            assert(small.get(i * 1000, value) && value == -i);
+        assert(!small.contains(1) && !small.contains(n * 1000));
+    }
+
+    // Frozen from a HashMap; string keys are found through string_view.
+    dsa::HashMap<std::string, int> source;
+    for (int i = 0; i < 5000; ++i)
+        source.put("key" + std::to_string(i), i);
+    dsa::FrozenHashMap<std::string, int> words(source);
+    assert(words.size() == 5000);
+    std::string_view view = "key4321 and more";
+    assert(*words.find(view.substr(0, 7)) == 4321 && !words.contains("key5000"));
+    dsa::SwissHashMap<std::string, int> swiss;
+    swiss.put("a", 1);
+    swiss.put("b", 2);
+    dsa::FrozenHashMap<std::string, int> fromSwiss(swiss);
+    assert(fromSwiss.size() == 2 && *fromSwiss.find("b") == 2 && !fromSwiss.contains("c"));
+
+    // A saved map loads back identical.
+    std::stringstream stream;
+    words.save(stream);
+    auto loaded = dsa::FrozenHashMap<std::string, int>::load(stream);
+    assert(loaded.size() == words.size());
+    for (int i = 0; i < 5000; ++i)
+        assert(loaded.get("key" + std::to_string(i), value) && value == i);
+    assert(!loaded.contains("key5000"));
+
+    std::stringstream numberStream;
+    numbers.save(numberStream);
+    auto loadedNumbers = dsa::FrozenHashMap<int, int>::load(numberStream);
+    assert(loadedNumbers.get(7 * 500 + 1, value) && value == 500);
+
+    // Truncated or foreign data is rejected.
+    std::string bytes = stream.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() / 2));
+    bool threw = false;
+    try {
+        dsa::FrozenHashMap<std::string, int>::load(truncated);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    // Corrupt sizes are caught before they are allocated: a header claiming
+    // 2^60 entries, then a first key claiming to be 2^62 bytes long.
+    auto loadFails = [](std::string data) {
+        std::stringstream corrupt(data);
+        try {
+            dsa::FrozenHashMap<std::string, int>::load(corrupt);
+        } catch (const std::runtime_error&) {
+            return true;
+        }
+        return false;
+    };
+    auto patch = [](std::string data, std::size_t offset, std::uint64_t field) {
+        std::memcpy(&data[offset], &field, sizeof(field));
+        return data;
+    };
+    const std::uint64_t huge = std::uint64_t(1) << 60;
+    assert(loadFails(patch(patch(bytes, 8, huge), 16, huge + huge / 99)));
+    assert(loadFails(patch(bytes, 8, 5001)));
+    assert(loadFails(patch(bytes, 24, 999)));
+    const std::size_t firstKey = 40 + 1000 * sizeof(std::uint16_t) + 51 * sizeof(std::uint32_t);
+    assert(loadFails(patch(bytes, firstKey, std::uint64_t(1) << 62)));
+    assert(!loadFails(bytes));
+
+    std::stringstream garbage("not a frozen map");
+    threw = false;
+    try {
+        dsa::FrozenHashMap<std::string, int>::load(garbage);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+
+    // Duplicate keys cannot be told apart.
+    std::vector<std::pair<int, int>> twice = {{1, 1}, {2, 2}, {1, 3}};
+    threw = false;
+    try {
+        dsa::FrozenHashMap<int, int> broken(twice.begin(), twice.end());
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    return 0;
+}
@@ -0,0 +1,50 @@
+/**
+ * @file test_FrozenSearchTree.cpp
+ * @brief Tests the FrozenSearchTree class.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+#include <vector>
+#include "dsa/FrozenSearchTree.hpp"
+
+int main() {
+    // Every size up to a few full levels, every probe between and beyond the keys.
+    for (int n = 0; n <= 70; ++n) {
+        std::vector<int> keys;
+        for (int i = 0; i < n; ++i)
+            keys.push_back(2 * i + 1);
+        dsa::FrozenSearchTree<int> table(keys.begin(), keys.end());
+        assert(table.size() == static_cast<std::size_t>(n));
+        for (int probe = -1; probe <= 2 * n + 1; ++probe) {
+            auto expected = std::lower_bound(keys.begin(), keys.end(), probe);
+            const int* found = table.lower_bound(probe);
+            if (expected == keys.end())
+                assert(found == nullptr);
+            else
+                assert(found && *found == *expected);
+            assert(table.contains(probe) == (probe % 2 != 0 && probe > 0 && probe < 2 * n));
+        }
+    }
+
+    // Freezing a BinarySearchTree keeps its contents; copies are independent.
+    dsa::RedBlackTree<int> tree;
+    for (int v : {50, 20, 80, 10, 30, 70, 90})
+        tree.insert(v);
+    dsa::FrozenSearchTree<int> frozen(tree);
+    tree.remove(30);
+    assert(frozen.size() == 7 && frozen.contains(30));
+    dsa::FrozenSearchTree<int> copy = frozen;
+    dsa::FrozenSearchTree<int> moved = std::move(frozen);
+    assert(frozen.empty() && !frozen.contains(30) && frozen.lower_bound(0) == nullptr);
+    assert(copy.contains(90) && moved.contains(10) && *moved.lower_bound(55) == 70);
+
+    // Duplicates are kept and non-trivial types work.
+    std::vector<std::string> words = {"ant", "bee", "bee", "cat", "dog"};
+    dsa::FrozenSearchTree<std::string> dictionary(words.begin(), words.end());
+    assert(dictionary.size() == 5);
+    assert(dictionary.contains("bee") && !dictionary.contains("cow"));
+    assert(*dictionary.lower_bound("cow") == "dog");
+    return 0;
+}
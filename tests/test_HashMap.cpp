@@ -4,18 +4,237 @@
  */
 
  #include <cassert>
+ #include <cstdlib>
+ #include <random>
+ #include <stdexcept>
  #include <string>
+ #include <string_view>
+ #include <unordered_map>
+ #include <unordered_set>
  #include "dsa/HashMap.hpp"
- 
- int main() {
-     dsa::HashMap<std::string, int> hashmap;
+
+ // Checks every key in [0, range) against a reference map.
+ template<typename Map>
+ bool sameEntries(const Map& map, const std::unordered_map<int, int>& expected, int range) {
+     if (map.size() != expected.size())
+         return false;
+     for (int key = 0; key < range; ++key) {
+         int value = -1;
+         bool found = map.get(key, value);
+         auto it = expected.find(key);
+         if (found != (it != expected.end()) || (found && value != it->second))
+             return false;
+     }
+     return true;
+ }
+
+ // Sends every key to the same home slot.
+ struct ConstantHash {
+     std::size_t operator()(int) const { return 42; }
+ };
+
+ // Runs string, sequential and random workloads against a layout.
+ template<typename Layout>
+ void testLayout() {
+     dsa::HashMap<std::string, int, Layout> hashmap;
      hashmap.put("key1", 100);
      int value;
      bool found = hashmap.get("key1", value);
      assert(found && value == 100);
      hashmap.remove("key1");
      found = hashmap.get("key1", value);
-     assert(!found);
+     assert(!found && hashmap.empty());
+
+     // Sequential keys, then removal of every other one.
+     dsa::HashMap<int, int, Layout> map(4);
+     std::unordered_map<int, int> reference;
+     for (int i = 0; i < 5000; ++i) {
+         map.put(i, i * 3);
+         reference[i] = i * 3;
+     }
+     for (int i = 0; i < 5000; i += 2) {
+         map.remove(i);
+         reference.erase(i);
+     }
+     assert(sameEntries(map, reference, 5000));
+
+     // Random puts, overwrites and removes over a small key range, so runs of
+     // colliding entries keep forming and being shifted back.
+     std::srand(3);
+     for (int i = 0; i < 200000; ++i) {
+         int key = std::rand() % 3000;
+         if (std::rand() % 3) {
+             map.put(key, i);
+             reference[key] = i;
+         } else {
+             map.remove(key);
+             reference.erase(key);
+         }
+     }
+     assert(sameEntries(map, reference, 5000));
+
+     // Copies are deep; moved-from maps are empty but usable.
+     dsa::HashMap<int, int, Layout> copy(map);
+     map.put(1, -1);
+     assert(sameEntries(copy, reference, 5000));
+     dsa::HashMap<int, int, Layout> moved(std::move(copy));
+     assert(sameEntries(moved, reference, 5000));
+     dsa::HashMap<int, int, Layout> again(moved);
+     assert(sameEntries(again, reference, 5000) && copy.empty());
+     copy.put(2, 2);
+     assert(copy.size() == 1);
+
+     // Non-trivial keys survive growth and removal.
+     dsa::HashMap<std::string, std::string, Layout> words;
+     for (int i = 0; i < 1000; ++i)
+         words.put("word" + std::to_string(i), std::string(i % 40, 'x'));
+     for (int i = 0; i < 1000; i += 3)
+         words.remove("word" + std::to_string(i));
+     assert(words.size() == 666);
+     std::string text;
+     assert(words.get("word500", text) && text == std::string(20, 'x'));
+     assert(!words.get("word999", text));
+
+     // find() points at the stored value; string keys are found through
+     // string_view and C strings without building a std::string.
+     std::string* stored = words.find(std::string("word500"));
+     assert(stored && *stored == std::string(20, 'x'));
+     *stored = "changed";
+     std::string_view view = "word500 and more";
+     assert(*words.find(view.substr(0, 7)) == "changed");
+     const auto& constWords = words;
+     assert(constWords.find("word999") == nullptr && constWords.contains("word1"));
+     assert(words.get(view.substr(0, 6), text) && text == std::string(10, 'x'));
+
+     // operator[] inserts a value-initialized entry only when absent.
+     dsa::HashMap<std::string, int, Layout> counts(2);
+     for (int i = 0; i < 3000; ++i)
+         ++counts["k" + std::to_string(i % 500)];
+     assert(counts.size() == 500 && counts["k7"] == 6 && *counts.find("k499") == 6);
+     assert(counts["new"] == 0 && counts.size() == 501 && counts.contains(std::string_view("new")));
+
+     // reserve() makes room up front; lowering the maximum load factor grows
+     // the table at once. Strided keys share their low bits.
+     dsa::HashMap<int, int, Layout> sized;
+     sized.reserve(10000);
+     const std::size_t reserved = sized.bucket_count();
+     for (int i = 0; i < 10000; ++i)
+         sized.put(i * 1024, i);
+     assert(sized.bucket_count() == reserved && sized.load_factor() <= sized.max_load_factor());
+     sized.max_load_factor(0.25f);
+     assert(sized.max_load_factor() == 0.25f && sized.bucket_count() > reserved);
+     assert(sized.load_factor() <= 0.25f && sized.size() == 10000);
+     for (int i = 0; i < 10000; ++i)
+         assert(*sized.find(i * 1024) == i);
+     bool threw = false;
+     try {
+         sized.max_load_factor(0.0f);
+     } catch (const std::invalid_argument&) {
+         threw = true;
+     }
+     assert(threw && sized.max_load_factor() == 0.25f);
+
+     // for_each() visits every entry once.
+     std::unordered_map<int, int> visited;
+     map.for_each([&visited](const int& key, const int& stored) { visited[key] += stored + 1; });
+     for (auto& entry : visited)
+         --entry.second;
+     assert(visited.size() == map.size() && sameEntries(map, visited, 5000));
+ }
+
+ int main() {
+     testLayout<dsa::SeparateChaining>();
+     testLayout<dsa::BasicSeparateChaining<dsa::Xxh3Mix>>();
+     testLayout<dsa::BasicSeparateChaining<dsa::NoMix>>();
+     testLayout<dsa::IncrementalChaining>();
+     testLayout<dsa::SwissTable>();
+     testLayout<dsa::RobinHood>();
+
+     // Chained values never move: not when the table grows at once, nor
+     // while an incremental rehash moves buckets across.
+     dsa::HashMap<int, int> chained(1);
+     dsa::IncrementalHashMap<int, int> incremental(1);
+     int* first = &chained[0];
+     int* firstIncremental = &incremental[0];
+     for (int i = 1; i < 20000; ++i) {
+         chained.put(i, i);
+         incremental.put(i, i);
+         if (i % 7 == 0)
+             incremental.remove(i - 3);
+         assert(incremental.find(i - 1) != nullptr || (i - 1) % 7 == 4);
+     }
+     assert(chained.find(0) == first && incremental.find(0) == firstIncremental);
+     assert(incremental.size() == 20000 - 19999 / 7 && incremental.contains(19999));
+
+     // Copies and assignments taken halfway through a split see every entry.
+     dsa::IncrementalHashMap<int, int> splitting(1);
+     for (int i = 0; i < 1600; ++i)
+         splitting.put(i, i);
+     dsa::IncrementalHashMap<int, int> snapshot(splitting);
+     chained = dsa::HashMap<int, int>();
+     dsa::IncrementalHashMap<int, int> assigned;
+     assigned = splitting;
+     for (int i = 0; i < 1600; ++i)
+         assert(*snapshot.find(i) == i && *assigned.find(i) == i && *splitting.find(i) == i);
+     assert(snapshot.size() == 1600 && assigned.size() == 1600 && chained.empty());
+     long long keySum = 0;
+     splitting.for_each([&keySum](int key, int) { keySum += key; });
+     assert(keySum == 1599LL * 1600 / 2);
+
+     // An empty Swiss table allocates on first use.
+     dsa::SwissHashMap<int, int> lazy(0);
+     int value;
+     assert(!lazy.get(7, value));
+     lazy.remove(7);
+     lazy.put(7, 70);
+     assert(lazy.get(7, value) && value == 70 && lazy.size() == 1);
+
+     // Robin Hood tables fill to 90% before growing and stay correct there.
+     dsa::RobinHoodHashMap<int, int> dense(900);
+     for (int i = 0; i < 900; ++i)
+         dense.put(i * 7919, i);
+     for (int i = 0; i < 900; i += 2)
+         dense.remove(i * 7919);
+     for (int i = 0; i < 900; ++i)
+         assert(dense.get(i * 7919, value) == (i % 2 == 1) && (i % 2 == 0 || value == i));
+
+     // Random keys filling a large Robin Hood table to 0.89 load form long
+     // runs, where one insertion displaces many entries.
+     dsa::RobinHoodHashMap<int, int> full;
+     std::unordered_set<int> keys;
+     std::mt19937 rng(42);
+     while (keys.size() < 933000) {
+         int key = static_cast<int>(rng());
+         if (keys.insert(key).second)
+             full.put(key, key / 2);
+     }
+     assert(full.size() == keys.size() && full.load_factor() > 0.88f);
+     for (int key : keys)
+         assert(full.get(key, value) && value == key / 2);
+
+     // Keys that all share one hash cannot be spread by growing: the Robin
+     // Hood table refuses the insert that needs a 255-slot probe, and stays
+     // intact.
+     dsa::HashMap<int, int, dsa::RobinHood, ConstantHash> clash;
+     int accepted = 0;
+     bool refused = false;
+     for (int i = 0; i < 300 && !refused; ++i) {
+         try {
+             clash.put(i, i);
+             ++accepted;
+         } catch (const std::length_error&) {
+             refused = true;
+         }
+     }
+     assert(refused && accepted >= 254 && clash.size() == static_cast<std::size_t>(accepted));
+     for (int i = 0; i < accepted; ++i)
+         assert(clash.get(i, value) && value == i);
+     assert(!clash.contains(accepted));
+
+     // Open-addressing layouts cap the maximum load factor at their limit.
+     dense.max_load_factor(1.5f);
+     assert(dense.max_load_factor() <= 0.9f && dense.max_load_factor() > 0.89f);
+     lazy.max_load_factor(1.0f);
+     assert(lazy.max_load_factor() == 0.875f);
      return 0;
  }
- 
\ No newline at end of file
@@ -4,8 +4,42 @@
  */
 
  #include <cassert>
+ #include <cstdlib>
+ #include <iterator>
+ #include <new>
+ #include <sstream>
+ #include <string>
+ #include <vector>
  #include "dsa/LinkedList.hpp"
  
+ // LinkedList takes its node blocks from aligned operator new; count the live ones.
+ static int liveBlocks = 0;
+ 
+ void* operator new(std::size_t size, std::align_val_t align) {
+     std::size_t alignment = static_cast<std::size_t>(align);
+     void* p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+     if (!p)
+         throw std::bad_alloc();
+     ++liveBlocks;
+     return p;
+ }
+ 
+ void operator delete(void* p, std::align_val_t) noexcept {
+     if (p)
+         --liveBlocks;
+     std::free(p);
+ }
+ 
+ void operator delete(void* p, std::size_t, std::align_val_t align) noexcept {
+     operator delete(p, align);
+ }
+ 
+ // Collects the list's elements in order.
+ template<typename T>
+ std::vector<T> contents(dsa::LinkedList<T>& list) {
+     return std::vector<T>(list.begin(), list.end());
+ }
+ 
  int main() {
      dsa::LinkedList<int> list;
      list.push_back(10);
@@ -14,6 +48,72 @@
      assert(list.front() == 10);
      list.pop_front();
      assert(list.front() == 20);
+ 
+     // Range pushes keep their order on both ends.
+     std::vector<int> values{1, 2, 3, 4, 5};
+     list.push_back_range(values.begin(), values.end());
+     list.push_front_range(values.begin(), values.begin() + 2);
+     assert((contents(list) == std::vector<int>{2, 1, 20, 1, 2, 3, 4, 5}));
+     list.pop_back();
+     std::vector<int> popped;
+     std::size_t poppedCount = list.pop_front_n(std::back_inserter(popped), 3);
+     assert(poppedCount == 3);
+     assert((popped == std::vector<int>{2, 1, 20}) && list.size() == 4);
+ 
+     // Input iterators are read once, without reserving ahead.
+     std::istringstream input("7 8 9");
+     list.push_back_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+     assert((contents(list) == std::vector<int>{1, 2, 3, 4, 7, 8, 9}));
+ 
+     // Nodes freed by pops are reused, across many batches and single pushes.
+     dsa::LinkedList<std::string> words;
+     for (int round = 0; round < 50; ++round) {
+         std::vector<std::string> batch(round * 37 % 300, std::string(round, 'w'));
+         words.push_back_range(batch.begin(), batch.end());
+         words.push_front(std::to_string(round));
+         std::vector<std::string> out;
+         words.pop_front_n(std::back_inserter(out), words.size() / 2);
+         if (!words.empty())
+             words.pop_back();
+     }
+     std::size_t count = words.size();
+     while (!words.empty())
+         words.pop_front();
+     assert(count > 0 && words.size() == 0);
+ 
+     // Copies are deep and moved-from lists stay usable.
+     dsa::LinkedList<int> copy(list);
+     list.push_front(0);
+     assert((contents(copy) == std::vector<int>{1, 2, 3, 4, 7, 8, 9}));
+     dsa::LinkedList<int> moved(std::move(copy));
+     assert(copy.empty() && moved.size() == 7);
+     copy.push_back(42);
+     copy = moved;
+     moved = dsa::LinkedList<int>();
+     moved.push_back_range(values.begin(), values.end());
+     assert(copy.size() == 7 && copy.front() == 1 && moved.size() == 5);
+ 
+     // Emptying a list frees its blocks, however the elements leave.
+     dsa::LinkedList<int> spike;
+     for (int i = 0; i < 10000; ++i)
+         spike.push_back(i);
+     int before = liveBlocks;
+     while (!spike.empty())
+         spike.pop_front();
+     assert(liveBlocks < before);
+     before = liveBlocks;
+     spike.push_back_range(values.begin(), values.end());
+     std::size_t drained = spike.pop_front_n(std::back_inserter(popped), 10);
+     assert(drained == 5 && liveBlocks == before);
+ 
+     // shrink_to_fit() leaves a shrunk list in one block of its own.
+     for (int i = 0; i < 10000; ++i)
+         spike.push_back(i);
+     std::vector<int> rest;
+     spike.pop_front_n(std::back_inserter(rest), 9990);
+     spike.shrink_to_fit();
+     assert(liveBlocks == before + 1 && spike.size() == 10 && spike.front() == 9990);
+     spike.pop_back();
+     assert(contents(spike).back() == 9998);
      return 0;
  }
- 
\ No newline at end of file
@@ -0,0 +1,56 @@
+/**
+ * @file test_MPMCQueue.cpp
+ * @brief Tests the MPMCQueue class.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include "dsa/MPMCQueue.hpp"
+
+int main() {
+    dsa::MPMCQueue<int> queue(4);
+    int accepted = 0;
+    for (int i = 0; i < 5; ++i)
+        accepted += queue.try_enqueue(i) ? 1 : 0;
+    assert(accepted == 4);
+    assert(queue.size() == 4);
+    int value = -1;
+    bool ok = queue.try_dequeue(value);
+    assert(ok && value == 0);
+    while (queue.try_dequeue(value)) {}
+    assert(value == 3);
+    assert(queue.empty());
+
+    // Several producers and consumers: every element is delivered exactly once.
+    const int producers = 3, consumers = 3, perProducer = 20000;
+    dsa::MPMCQueue<int> shared(128);
+    std::atomic<long long> sum{0};
+    std::atomic<int> received{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p)
+        threads.emplace_back([&] {
+            for (int i = 1; i <= perProducer; ++i)
+                while (!shared.try_enqueue(i))
+                    std::this_thread::yield();
+        });
+    for (int c = 0; c < consumers; ++c)
+        threads.emplace_back([&] {
+            int item;
+            while (received.load() < producers * perProducer) {
+                if (shared.try_dequeue(item)) {
+                    sum += item;
+                    ++received;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    for (auto& t : threads)
+        t.join();
+    long long expected = static_cast<long long>(producers) * perProducer * (perProducer + 1) / 2;
+    assert(sum.load() == expected);
+    assert(shared.empty());
+    return 0;
+}
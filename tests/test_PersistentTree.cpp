@@ -0,0 +1,111 @@
+/**
+ * @file test_PersistentTree.cpp
+ * @brief Tests the PersistentTree class.
+ */
+
+#include <atomic>
+#include <cassert>
+#include <cstdlib>
+#include <set>
+#include <thread>
+#include <vector>
+#include "dsa/PersistentTree.hpp"
+
+// Checks that a snapshot holds exactly the elements of a reference set, in order.
+template<typename Snapshot>
+bool sameContents(const Snapshot& snap, const std::set<int>& expected) {
+    std::vector<int> actual;
+    snap.for_each([&](int v) { actual.push_back(v); });
+    return snap.size() == expected.size() &&
+           actual == std::vector<int>(expected.begin(), expected.end());
+}
+
+int main() {
+    // Single-threaded behaviour matches std::set.
+    {
+        dsa::PersistentTree<int> tree;
+        std::set<int> reference;
+        std::srand(21);
+        for (int i = 0; i < 20000; ++i) {
+            int key = std::rand() % 1500;
+            if (std::rand() % 2) {
+                bool inserted = tree.insert(key);
+                bool expected = reference.insert(key).second;
+                assert(inserted == expected);
+            } else {
+                bool removed = tree.remove(key);
+                bool expected = reference.erase(key) == 1;
+                assert(removed == expected);
+            }
+        }
+        assert(sameContents(tree.snapshot(), reference));
+        assert(tree.size() == reference.size());
+        // With no snapshot held, every replaced node has been freed.
+        assert(tree.retired() == 0);
+    }
+
+    // A snapshot is isolated from later updates and keeps its nodes alive.
+    {
+        dsa::PersistentTree<int> tree(4);
+        for (int i = 0; i < 100; ++i)
+            tree.insert(i);
+        auto before = tree.snapshot();
+        for (int i = 0; i < 100; i += 2)
+            tree.remove(i);
+        tree.insert(500);
+        assert(tree.retired() > 0);
+        std::set<int> all;
+        for (int i = 0; i < 100; ++i)
+            all.insert(i);
+        assert(sameContents(before, all));
+        assert(before.contains(4) && !before.contains(500));
+        assert(*before.lower_bound(50) == 50);
+        auto after = tree.snapshot();
+        assert(!after.contains(4) && after.contains(500) && *after.lower_bound(50) == 51);
+        assert(after.size() == 51);
+        {
+            auto moved = std::move(before);
+            assert(moved.size() == 100);
+        }
+        tree.insert(501);
+        auto last = tree.snapshot();
+        assert(last.size() == 52);
+    }
+
+    // Concurrent readers always see a complete, sorted version.
+    {
+        dsa::PersistentTree<int> tree(8);
+        std::atomic<bool> done(false);
+        std::atomic<bool> ok(true);
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 4; ++r) {
+            readers.emplace_back([&] {
+                std::size_t lastSize = 0;
+                while (!done.load()) {
+                    auto snap = tree.snapshot();
+                    std::size_t count = 0;
+                    int prev = -1;
+                    bool sorted = true;
+                    snap.for_each([&](int v) {
+                        sorted = sorted && v > prev;
+                        prev = v;
+                        ++count;
+                    });
+                    // The writer only inserts 0, 1, 2, ... so versions grow as prefixes.
+                    if (!sorted || count != snap.size() || count < lastSize ||
+                        (count > 0 && prev != static_cast<int>(count) - 1))
+                        ok.store(false);
+                    lastSize = count;
+                }
+            });
+        }
+        for (int i = 0; i < 20000; ++i)
+            tree.insert(i);
+        done.store(true);
+        for (auto& t : readers)
+            t.join();
+        assert(ok.load());
+        assert(tree.size() == 20000);
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file test_PriorityQueue.cpp
+ * @brief Tests the PriorityQueue and IndexedPriorityQueue classes.
+ */
+
+#include <cassert>
+#include <functional>
+#include <vector>
+#include "dsa/PriorityQueue.hpp"
+
+int main() {
+    // Max-heap built by heapify pops in descending order.
+    std::vector<int> values = {5, 1, 9, 3, 7, 2, 8, 6, 4, 0};
+    dsa::PriorityQueue<int> maxHeap(values.begin(), values.end());
+    assert(maxHeap.size() == values.size());
+    for (int expected = 9; expected >= 0; --expected) {
+        assert(maxHeap.top() == expected);
+        maxHeap.pop();
+    }
+    assert(maxHeap.empty());
+
+    // 4-ary min-heap via push.
+    dsa::PriorityQueue<int, std::greater<int>, 4> minHeap;
+    for (int v : values)
+        minHeap.push(v);
+    for (int expected = 0; expected <= 9; ++expected) {
+        assert(minHeap.top() == expected);
+        minHeap.pop();
+    }
+
+    // Indexed min-heap: decrease_key, update and erase by handle.
+    dsa::IndexedPriorityQueue<int, std::greater<int>> ipq;
+    auto a = ipq.push(10);
+    auto b = ipq.push(20);
+    auto c = ipq.push(30);
+    assert(ipq.top_handle() == a);
+    ipq.decrease_key(c, 5);
+    assert(ipq.top_handle() == c && ipq.get(c) == 5);
+    ipq.update(c, 25);
+    assert(ipq.top_handle() == a);
+    ipq.erase(a);
+    assert(!ipq.contains(a) && ipq.size() == 2);
+    assert(ipq.top() == 20);
+    bool threw = false;
+    try {
+        ipq.decrease_key(b, 40);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    auto d = ipq.push(1);
+    assert(d == a); // Handles are recycled.
+    ipq.pop();
+    ipq.pop();
+    assert(ipq.top_handle() == c);
+    return 0;
+}
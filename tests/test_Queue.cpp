@@ -4,6 +4,8 @@
  */
 
  #include <cassert>
+ #include <iterator>
+ #include <vector>
  #include "dsa/Queue.hpp"
  
  int main() {
@@ -13,6 +15,24 @@
      assert(queue.front() == 100);
      queue.dequeue();
      assert(queue.front() == 200);
+
+     // Bulk operations keep FIFO order.
+     std::vector<int> batch = {1, 2, 3, 4};
+     queue.enqueue_range(batch.begin(), batch.end());
+     assert(queue.size() == 5);
+     std::vector<int> out;
+     std::size_t n = queue.dequeue_n(std::back_inserter(out), 3);
+     assert(n == 3 && out == std::vector<int>({200, 1, 2}));
+     n = queue.dequeue_n(std::back_inserter(out), 10);
+     assert(n == 2 && queue.empty());
+     queue.enqueue(5);
+     assert(queue.front() == 5);
+
+     // A queue that spiked can give back the room it no longer needs.
+     std::vector<int> spike(5000, 7);
+     queue.enqueue_range(spike.begin(), spike.end());
+     n = queue.dequeue_n(std::back_inserter(out), 4999);
+     queue.shrink_to_fit();
+     assert(n == 4999 && queue.size() == 2 && queue.front() == 7);
      return 0;
  }
- 
\ No newline at end of file
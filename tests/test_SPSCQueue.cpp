@@ -0,0 +1,58 @@
+/**
+ * @file test_SPSCQueue.cpp
+ * @brief Tests the SPSCQueue class.
+ */
+
+#include <cassert>
+#include <thread>
+#include "dsa/SPSCQueue.hpp"
+
+int main() {
+    dsa::SPSCQueue<int> queue(3);
+    assert(queue.capacity() == 4);
+    assert(queue.empty());
+    int pushed = 0;
+    for (int i = 0; i < 5; ++i)
+        pushed += queue.try_push(i) ? 1 : 0;
+    assert(pushed == 4);
+    int value = -1;
+    bool popped = queue.try_pop(value);
+    assert(popped && value == 0);
+
+    // Batches wrap around the end of the ring.
+    int in[3] = {10, 11, 12};
+    std::size_t n = queue.push_n(in, 3);
+    assert(n == 1);
+    int out[8];
+    n = queue.pop_n(out, 8);
+    assert(n == 4);
+    assert(out[0] == 1 && out[2] == 3 && out[3] == 10);
+    assert(queue.empty());
+
+    // One producer, one consumer: every element arrives once, in order.
+    const int count = 100000;
+    dsa::SPSCQueue<int> channel(64);
+    std::thread producer([&] {
+        for (int i = 0; i < count;) {
+            int batch[16];
+            int k = 0;
+            while (k < 16 && i + k < count) {
+                batch[k] = i + k;
+                ++k;
+            }
+            i += static_cast<int>(channel.push_n(batch, k));
+        }
+    });
+    int expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        if (channel.try_pop(value)) {
+            ordered = ordered && value == expected;
+            ++expected;
+        }
+    }
+    producer.join();
+    assert(ordered);
+    assert(channel.empty());
+    return 0;
+}
@@ -4,6 +4,8 @@
  */
 
  #include <cassert>
+ #include <iterator>
+ #include <vector>
  #include "dsa/Stack.hpp"
  
  int main() {
@@ -13,6 +15,16 @@
      assert(stack.top() == 10);
      stack.pop();
      assert(stack.top() == 5);
+
+     // Bulk operations match repeated push/pop.
+     std::vector<int> batch = {1, 2, 3};
+     stack.push_range(batch.begin(), batch.end());
+     assert(stack.size() == 4 && stack.top() == 3);
+     std::vector<int> out;
+     std::size_t n = stack.pop_n(std::back_inserter(out), 10);
+     assert(n == 4 && out == std::vector<int>({3, 2, 1, 5}));
+     assert(stack.empty());
+     stack.push_range(batch.begin(), batch.end());
+     assert(stack.top() == 3);
      return 0;
  }
- 
\ No newline at end of file
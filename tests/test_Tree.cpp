@@ -4,8 +4,139 @@
  */
 
  #include <cassert>
+ #include <cstdlib>
+ #include <iterator>
+ #include <set>
+ #include <stdexcept>
+ #include <vector>
  #include "dsa/Tree.hpp"
- 
+
+ // Checks a tree's contents against a reference set.
+ template<typename Tree>
+ bool sameContents(Tree& tree, const std::set<int>& expected) {
+     std::vector<int> actual;
+     for (auto it = tree.begin(); it != tree.end(); ++it)
+         actual.push_back(*it);
+     return actual == std::vector<int>(expected.begin(), expected.end());
+ }
+
+ // Checks size, rank, select and count_range against a reference set.
+ template<typename Tree>
+ bool sameOrderStatistics(const Tree& tree, const std::set<int>& expected) {
+     if (tree.size() != expected.size())
+         return false;
+     std::size_t k = 0;
+     for (int v : expected) {
+         if (tree.select(k) != v || tree.rank(v) != k || tree.rank(v + 1) != k + 1)
+             return false;
+         ++k;
+     }
+     for (int lo = -5; lo < 3000; lo += 97) {
+         int hi = lo + 250;
+         std::size_t count = static_cast<std::size_t>(
+             std::distance(expected.lower_bound(lo), expected.lower_bound(hi)));
+         if (tree.count_range(lo, hi) != count || tree.count_range(hi, lo) != 0)
+             return false;
+     }
+     return true;
+ }
+
+ // Runs sorted, reverse-sorted and random workloads against a balanced policy.
+ template<typename Balance>
+ void testBalanced(std::size_t maxHeight) {
+     dsa::BinarySearchTree<int, Balance> tree;
+     std::set<int> reference;
+     for (int i = 0; i < 1000; ++i) {
+         tree.insert(i);
+         reference.insert(i);
+     }
+     for (int i = 1999; i >= 1000; --i) {
+         tree.insert(i);
+         reference.insert(i);
+     }
+     assert(tree.height() <= maxHeight);
+     for (int i = 0; i < 2000; i += 2) {
+         bool removed = tree.remove(i);
+         reference.erase(i);
+         assert(removed);
+     }
+     assert(tree.height() <= maxHeight);
+     assert(sameContents(tree, reference));
+
+     std::srand(7);
+     for (int i = 0; i < 20000; ++i) {
+         int key = std::rand() % 3000;
+         if (std::rand() % 2) {
+             tree.insert(key);
+             reference.insert(key);
+         } else {
+             bool removed = tree.remove(key);
+             bool expected = reference.erase(key) == 1;
+             assert(removed == expected);
+         }
+     }
+     assert(tree.height() <= maxHeight);
+     assert(sameContents(tree, reference));
+     assert(sameOrderStatistics(tree, reference));
+
+     dsa::BinarySearchTree<int, Balance> copy(tree);
+     assert(sameContents(copy, reference));
+     assert(sameOrderStatistics(copy, reference));
+ }
+
+ // Bulk-built trees are minimal-height and stay valid under later updates.
+ template<typename Balance>
+ void testBulkBuild(std::size_t maxHeight) {
+     for (int n = 0; n <= 130; ++n) {
+         std::vector<int> sorted;
+         for (int i = 0; i < n; ++i)
+             sorted.push_back(i * 2);
+         auto tree = dsa::BinarySearchTree<int, Balance>::from_sorted(sorted.begin(), sorted.end());
+         std::size_t minHeight = 0;
+         while ((std::size_t(1) << minHeight) <= static_cast<std::size_t>(n))
+             ++minHeight;
+         assert(tree.height() == minHeight);
+         std::set<int> reference(sorted.begin(), sorted.end());
+         assert(sameContents(tree, reference));
+         for (int i = 0; i < 3 * n; ++i) {
+             int key = (i * 37) % (2 * n + 1);
+             if (i % 2) {
+                 tree.insert(key);
+                 reference.insert(key);
+             } else {
+                 tree.remove(key);
+                 reference.erase(key);
+             }
+         }
+         assert(sameContents(tree, reference));
+         assert(sameOrderStatistics(tree, reference));
+     }
+
+     // Duplicates collapse; unsorted input may be sorted in parallel.
+     std::vector<int> duplicates = {1, 1, 2, 3, 3, 3, 4};
+     auto small = dsa::BinarySearchTree<int, Balance>::from_sorted(duplicates.begin(), duplicates.end());
+     assert(sameContents(small, std::set<int>{1, 2, 3, 4}));
+
+     std::vector<int> values;
+     std::srand(11);
+     for (int i = 0; i < 50000; ++i)
+         values.push_back(std::rand() % 3000);
+     auto big = dsa::BinarySearchTree<int, Balance>::from_unsorted(values.begin(), values.end(), 4);
+     std::set<int> reference(values.begin(), values.end());
+     assert(sameContents(big, reference));
+     for (int i = 0; i < 3000; i += 3) {
+         big.remove(i);
+         reference.erase(i);
+     }
+     for (int i = 3000; i < 6000; ++i) {
+         big.insert(i);
+         reference.insert(i);
+     }
+     assert(big.height() <= maxHeight);
+     assert(sameContents(big, reference));
+     assert(sameOrderStatistics(big, reference));
+ }
+
  int main() {
      dsa::BinarySearchTree<int> bst;
      bst.insert(15);
@@ -13,6 +144,140 @@
      bst.insert(20);
      assert(bst.search(10));
      assert(!bst.search(5));
+     assert(bst.height() == 2);
+     assert(bst.size() == 3 && bst.rank(20) == 2 && bst.select(0) == 10);
+     bool threw = false;
+     try {
+         bst.select(3);
+     } catch (const std::out_of_range&) {
+         threw = true;
+     }
+     assert(threw);
+
+     // Subtree sizes survive unbalanced removals too.
+     {
+         dsa::BinarySearchTree<int> plain;
+         std::set<int> reference;
+         std::srand(3);
+         for (int i = 0; i < 5000; ++i) {
+             int key = std::rand() % 1000;
+             if (std::rand() % 3) {
+                 plain.insert(key);
+                 reference.insert(key);
+             } else {
+                 plain.remove(key);
+                 reference.erase(key);
+             }
+         }
+         assert(sameOrderStatistics(plain, reference));
+     }
+
+     // A degenerate (list-shaped) tree is searched, copied, traversed and
+     // destroyed without recursion.
+     {
+         const int depth = 20000;
+         dsa::BinarySearchTree<int> chain;
+         for (int i = 0; i < depth; ++i)
+             chain.insert(i);
+         assert(chain.height() == static_cast<std::size_t>(depth));
+         assert(chain.search(depth - 1) && !chain.search(depth));
+         dsa::BinarySearchTree<int> copy(chain);
+         assert(copy.height() == static_cast<std::size_t>(depth));
+         int expected = 0;
+         for (auto it = copy.begin(); it != copy.end(); ++it) {
+             assert(*it == expected);
+             ++expected;
+         }
+         assert(expected == depth);
+     }
+
+     // Iterators are bidirectional, and const_iterator works on const trees.
+     {
+         dsa::RedBlackTree<int> tree;
+         for (int v : {4, 2, 6, 1, 3, 5, 7})
+             tree.insert(v);
+         const dsa::RedBlackTree<int>& view = tree;
+         dsa::RedBlackTree<int>::const_iterator it = view.end();
+         int expected = 7;
+         while (it != view.begin()) {
+             --it;
+             assert(*it == expected);
+             --expected;
+         }
+         assert(expected == 0);
+         auto mid = tree.begin();
+         ++mid;
+         ++mid;
+         assert(*mid == 3);
+         tree.remove(4);
+         tree.remove(2);
+         ++mid;
+         assert(*mid == 5);
+         dsa::RedBlackTree<int>::const_iterator converted = mid;
+         assert(converted == mid);
+         --converted;
+         assert(*converted == 3);
+     }
+
+     // Iterator lookups and lazily iterated ranges.
+     {
+         dsa::AVLTree<int> tree;
+         for (int v = 0; v < 100; v += 10)
+             tree.insert(v);
+         const dsa::AVLTree<int>& view = tree;
+         assert(tree.find(30) != tree.end() && *tree.find(30) == 30);
+         assert(view.find(35) == view.end());
+         assert(*tree.lower_bound(30) == 30 && *tree.lower_bound(31) == 40);
+         assert(*view.upper_bound(30) == 40 && view.upper_bound(90) == view.end());
+         assert(tree.lower_bound(-1) == tree.begin());
+         auto same = tree.equal_range(50);
+         assert(*same.begin() == 50 && std::next(same.begin()) == same.end());
+         assert(view.equal_range(55).empty());
+
+         std::vector<int> inRange;
+         for (int v : view.range(25, 70))
+             inRange.push_back(v);
+         assert((inRange == std::vector<int>{30, 40, 50, 60}));
+         assert(tree.range(70, 25).empty());
+         assert(tree.range(91, 1000).empty());
+         int last = 0;
+         for (int v : tree.range(60, 1000))
+             last = v;
+         assert(last == 90);
+     }
+
+     // Heights stay logarithmic even for sorted input (n <= 3000).
+     testBalanced<dsa::AVLBalance>(17);
+     testBalanced<dsa::RedBlackBalance>(23);
+     // Appending sorted keys degenerates the unbalanced tree, so no bound there.
+     testBulkBuild<dsa::NoBalance>(static_cast<std::size_t>(-1));
+     testBulkBuild<dsa::AVLBalance>(17);
+     testBulkBuild<dsa::RedBlackBalance>(23);
+     // Treap heights are O(log n) with high probability; the priority sequence is fixed.
+     testBalanced<dsa::TreapBalance>(32);
+     testBulkBuild<dsa::TreapBalance>(32);
+
+     // Boosting on lookups keeps contents, order statistics and iterators intact.
+     {
+         dsa::Treap<int> treap;
+         std::set<int> reference;
+         for (int i = 0; i < 1000; ++i) {
+             treap.insert(i);
+             reference.insert(i);
+         }
+         auto it = treap.find(700);
+         for (int round = 0; round < 50; ++round) {
+             for (int hot = 0; hot < 10; ++hot)
+                 assert(treap.search(hot * 97));
+             treap.insert(3);
+         }
+         const dsa::Treap<int>& view = treap;
+         assert(!view.search(5000) && view.find(-1) == view.end());
+         assert(*view.lower_bound(500) == 500 && *view.upper_bound(500) == 501);
+         assert(*it == 700 && *std::next(it) == 701);
+         assert(treap.height() <= 30);
+         assert(sameContents(treap, reference));
+         assert(sameOrderStatistics(treap, reference));
+     }
      return 0;
  }
- 
\ No newline at end of file
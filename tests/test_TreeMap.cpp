@@ -0,0 +1,126 @@
+/**
+ * @file test_TreeMap.cpp
+ * @brief Tests the TreeMap class.
+ */
+
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "dsa/TreeMap.hpp"
+
+// Checks a map's entries, in order, against a reference std::map.
+template<typename Map, typename Ref>
+bool sameEntries(const Map& map, const Ref& expected) {
+    if (map.size() != expected.size())
+        return false;
+    auto it = map.begin();
+    for (const auto& entry : expected) {
+        if (it == map.end() || it->first != entry.first || it->second != entry.second)
+            return false;
+        ++it;
+    }
+    return it == map.end();
+}
+
+// Comparator that counts calls, to check that lookups compare keys only.
+struct CountingLess {
+    int* calls;
+    bool operator()(int a, int b) const { ++*calls; return a < b; }
+};
+
+int main() {
+    // Randomized updates against std::map, with every balancing policy.
+    dsa::TreeMap<int, int> map;
+    dsa::TreeMap<int, int, std::less<int>, dsa::AVLBalance> avl;
+    dsa::TreeMap<int, int, std::less<int>, dsa::NoBalance> plain;
+    std::map<int, int> reference;
+    std::srand(9);
+    for (int i = 0; i < 20000; ++i) {
+        int key = std::rand() % 2000;
+        switch (std::rand() % 3) {
+        case 0: {
+            bool inserted = map.insert_or_assign(key, i).second;
+            avl.insert_or_assign(key, i);
+            plain.insert_or_assign(key, i);
+            bool expected = reference.find(key) == reference.end();
+            reference[key] = i;
+            assert(inserted == expected);
+            break;
+        }
+        case 1: {
+            bool inserted = map.try_emplace(key, i).second;
+            avl.try_emplace(key, i);
+            plain.try_emplace(key, i);
+            bool expected = reference.emplace(key, i).second;
+            assert(inserted == expected);
+            break;
+        }
+        default: {
+            bool removed = map.remove(key);
+            avl.remove(key);
+            plain.remove(key);
+            bool expected = reference.erase(key) == 1;
+            assert(removed == expected);
+        }
+        }
+    }
+    assert(sameEntries(map, reference));
+    assert(sameEntries(avl, reference));
+    assert(sameEntries(plain, reference));
+
+    // Bounds, at(), operator[] and erase by iterator.
+    auto lb = map.lower_bound(1000);
+    assert(lb != map.end() && lb->first == reference.lower_bound(1000)->first);
+    auto ub = map.upper_bound(lb->first);
+    assert(ub == map.end() || ub->first == reference.upper_bound(lb->first)->first);
+    bool threw = false;
+    try {
+        map.at(-1);
+    } catch (const std::out_of_range&) {
+        threw = true;
+    }
+    assert(threw);
+    map[-1] += 5;
+    assert(map.at(-1) == 5);
+    auto next = map.erase(map.find(-1));
+    assert(next == map.begin() && !map.contains(-1));
+    auto last = map.end();
+    --last;
+    assert(last->first == reference.rbegin()->first);
+
+    // Copies are deep.
+    dsa::TreeMap<int, int> copy = map;
+    copy[123456] = 1;
+    assert(!map.contains(123456) && sameEntries(map, reference));
+
+    // Lookups with a custom comparator compare keys only.
+    int calls = 0;
+    dsa::TreeMap<int, std::string, CountingLess> named(CountingLess{&calls});
+    named.try_emplace(2, "two");
+    named.try_emplace(1, "one");
+    named.try_emplace(3, "three");
+    calls = 0;
+    assert(named.find(3)->second == "three");
+    assert(calls <= 4);
+
+    // Heterogeneous lookup with a transparent comparator.
+    dsa::TreeMap<std::string, int, std::less<>> ages;
+    ages.insert_or_assign("ada", 36);
+    ages.try_emplace("alan", 41);
+    ages.insert_or_assign("ada", 37);
+    assert(ages.size() == 2);
+    assert(ages.find("ada")->second == 37 && ages.contains("alan") && !ages.contains("grace"));
+    assert(ages.lower_bound("al")->first == "alan");
+
+    // try_emplace leaves a move-only argument untouched when the key exists.
+    dsa::TreeMap<int, std::unique_ptr<int>> owners;
+    owners.try_emplace(1, std::make_unique<int>(10));
+    auto spare = std::make_unique<int>(20);
+    bool inserted = owners.try_emplace(1, std::move(spare)).second;
+    assert(!inserted && spare && *owners.at(1) == 10);
+    return 0;
+}
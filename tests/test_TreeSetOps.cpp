@@ -0,0 +1,91 @@
+/**
+ * @file test_TreeSetOps.cpp
+ * @brief Tests the join-based set operations on AVL trees.
+ */
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "dsa/TreeSetOps.hpp"
+
+namespace {
+
+dsa::AVLTree<int> makeTree(const std::vector<int>& values) {
+    dsa::AVLTree<int> tree;
+    for (int v : values)
+        tree.insert(v);
+    return tree;
+}
+
+std::vector<int> randomSet(std::mt19937& rng, std::size_t n, int range) {
+    std::uniform_int_distribution<int> dist(0, range);
+    std::vector<int> values;
+    for (std::size_t i = 0; i < n; ++i)
+        values.push_back(dist(rng));
+    std::sort(values.begin(), values.end());
+    values.erase(std::unique(values.begin(), values.end()), values.end());
+    return values;
+}
+
+// Checks contents, order statistics, and the AVL height bound.
+void expectTree(const dsa::AVLTree<int>& tree, const std::vector<int>& expected) {
+    assert(tree.size() == expected.size());
+    assert(std::equal(tree.begin(), tree.end(), expected.begin(), expected.end()));
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        assert(tree.select(i) == expected[i] && tree.rank(expected[i]) == i);
+    double bound = 1.4405 * std::log2(static_cast<double>(expected.size()) + 2.0);
+    assert(static_cast<double>(tree.height()) <= bound);
+}
+
+void checkAll(const std::vector<int>& a, const std::vector<int>& b, unsigned threads) {
+    std::vector<int> u, i, d;
+    std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(u));
+    std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(i));
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(d));
+    expectTree(dsa::set_union(makeTree(a), makeTree(b), threads), u);
+    expectTree(dsa::set_intersection(makeTree(a), makeTree(b), threads), i);
+    expectTree(dsa::set_difference(makeTree(a), makeTree(b), threads), d);
+}
+
+} // namespace
+
+int main() {
+    // Empty operands and identical sets.
+    checkAll({}, {}, 1);
+    checkAll({1, 2, 3}, {}, 1);
+    checkAll({}, {1, 2, 3}, 1);
+    checkAll({1, 2, 3}, {1, 2, 3}, 1);
+
+    // Disjoint ranges exercise join between trees of very different heights.
+    std::vector<int> low, high;
+    for (int v = 0; v < 1000; ++v)
+        low.push_back(v);
+    for (int v = 5000; v < 5003; ++v)
+        high.push_back(v);
+    checkAll(low, high, 1);
+    checkAll(high, low, 1);
+
+    // Random sets of mixed sizes and overlap, serial and parallel.
+    std::mt19937 rng(42);
+    for (std::size_t m : {1u, 10u, 300u, 5000u}) {
+        for (std::size_t n : {7u, 2000u, 20000u}) {
+            std::vector<int> a = randomSet(rng, m, 30000);
+            std::vector<int> b = randomSet(rng, n, 30000);
+            checkAll(a, b, 1);
+            checkAll(a, b, 4);
+        }
+    }
+
+    // Inputs passed by value are left untouched when copied in.
+    dsa::AVLTree<int> a = makeTree({1, 3, 5}), b = makeTree({3, 4});
+    dsa::AVLTree<int> both = dsa::set_union(a, b);
+    assert(a.size() == 3 && b.size() == 2);
+    expectTree(both, {1, 3, 4, 5});
+    both.insert(2);
+    both.remove(4);
+    expectTree(both, {1, 2, 3, 5});
+    return 0;
+}